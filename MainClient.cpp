@@ -3,6 +3,8 @@
 #include "MyPackets.h"
 #include "NetworkClientManager.h"
 #include "GameManager.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
 
 constexpr ScreenSizeValue HEIGHT = { 900.f };
 constexpr ScreenSizeValue WIDTH = { 700.f };
@@ -35,6 +37,7 @@ int main()
 	Application application(rollbackManager, gameManager, networkClientManager, WIDTH, HEIGHT);
 
 	sf::Clock clock;
+	sf::Clock profilerClock;
 	float time = FIXED_TIME_STEP;
 
 	while (application.IsRunning() && window.isOpen())
@@ -44,7 +47,10 @@ int main()
 
 		time += elapsed.asSeconds();
 
-		while (time >= FIXED_TIME_STEP)
+		// Stretched a little while ahead of the other client
+		float fixedTimeStep = application.GetFixedTimeStep();
+
+		while (time >= fixedTimeStep)
 		{
 			while (window.pollEvent(event))
 			{
@@ -82,7 +88,8 @@ int main()
 			application.AddLocalPlayerInput(playerInput);
 			application.FixedUpdate();
 
-			time -= FIXED_TIME_STEP;
+			time -= fixedTimeStep;
+			fixedTimeStep = application.GetFixedTimeStep();
 		}
 
 		const auto mousePosition = sf::Vector2f(sf::Mouse::getPosition(window));
@@ -90,6 +97,13 @@ int main()
 
 		application.Update(elapsed, timeSinceLastFixed, mousePosition);
 
+		if (profilerClock.getElapsedTime().asSeconds() >= PROFILER_EXPORT_INTERVAL)
+		{
+			Profiler::WriteFiles("client_profile");
+			MemoryTracker::WriteFiles("client_memory");
+			profilerClock.restart();
+		}
+
 		window.clear();
 		application.Draw(window);
 		window.display();
@@ -97,6 +111,8 @@ int main()
 
 	window.close();
 	networkClientManager.Stop();
+	Profiler::WriteFiles("client_profile");
+	MemoryTracker::WriteFiles("client_memory");
 
 	return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -0,0 +1,378 @@
+#include "AssetManager.h"
+#include "Application.h"
+#include "ClientNetworkInterface.h"
+#include "GameManager.h"
+#include "GameServer.h"
+#include "InputPredictor.h"
+#include "Logger.h"
+#include "MemoryTracker.h"
+#include "MyPackets.h"
+#include "Profiler.h"
+#include "RollbackManager.h"
+#include "ServerNetworkInterface.h"
+
+#include <SFML/Graphics.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+constexpr ScreenSizeValue HEIGHT = { 900.f };
+constexpr ScreenSizeValue WIDTH = { 700.f };
+
+constexpr int DEFAULT_FRAMES = 3'000;
+constexpr int DEFAULT_LATENCY_FRAMES = 3;
+// Rendered at 60 fps for a physics at 30 fps
+constexpr int RENDERS_PER_FIXED_UPDATE = 2;
+
+/**
+ * @brief Packets between the clients and the server of the benchmark, kept in memory and delivered after a fixed number of fixed updates
+ */
+class LocalNetwork final : public ServerNetworkInterface
+{
+ public:
+	explicit LocalNetwork(int latencyFrames) : _latencyFrames(latencyFrames) {}
+
+	LocalNetwork(const LocalNetwork&) = delete;
+	LocalNetwork& operator=(const LocalNetwork&) = delete;
+
+	~LocalNetwork()
+	{
+		for (auto& packet : _toServer) delete packet.Content;
+
+		for (auto& packets : _toClients)
+		{
+			for (auto& packet : packets) delete packet.Content;
+		}
+	}
+
+ private:
+	struct DelayedPacket
+	{
+		Packet* Content;
+		ClientId Client;
+		int DeliveryFrame;
+	};
+
+	std::deque<DelayedPacket> _toServer;
+	std::array<std::deque<DelayedPacket>, MAX_PLAYERS> _toClients;
+	int _latencyFrames;
+	int _frame = 0;
+
+	Packet* popDelivered(std::deque<DelayedPacket>& packets, ClientId& client)
+	{
+		if (packets.empty() || packets.front().DeliveryFrame > _frame) return nullptr;
+
+		auto* packet = packets.front().Content;
+		client = packets.front().Client;
+		packets.pop_front();
+
+		return packet;
+	}
+
+ public:
+	PacketData PopPacket() override
+	{
+		PacketData packetData;
+		packetData.PacketContent = popDelivered(_toServer, packetData.Client);
+
+		return packetData;
+	}
+
+	void SendPacket(Packet* packet, const ClientId& clientId, Protocol protocol) override
+	{
+		_toClients[clientId.Index].push_back({ packet, clientId, _frame + _latencyFrames });
+	}
+
+	ClientId PopDisconnectedClient() override
+	{
+		return EMPTY_CLIENT_ID;
+	}
+
+	Packet* PopClientPacket(int clientIndex)
+	{
+		ClientId client;
+
+		return popDelivered(_toClients[clientIndex], client);
+	}
+
+	void SendToServer(Packet* packet, int clientIndex)
+	{
+		_toServer.push_back({ packet, ClientId { clientIndex }, _frame + _latencyFrames });
+	}
+
+	/**
+	 * @brief Answer the UDP acknowledgment of a client, like the network server manager does
+	 */
+	void ConfirmUdpConnection(int clientIndex)
+	{
+		_toClients[clientIndex].push_back({ new ConfirmUDPConnectionPacket(), ClientId { clientIndex }, _frame + _latencyFrames });
+	}
+
+	void NextFrame()
+	{
+		_frame++;
+	}
+};
+
+/**
+ * @brief Client side of the local network, a client of the benchmark
+ */
+class LocalClientNetwork final : public ClientNetworkInterface
+{
+ public:
+	LocalClientNetwork(LocalNetwork& network, int clientIndex) : _network(network), _clientIndex(clientIndex) {}
+
+ private:
+	LocalNetwork& _network;
+	int _clientIndex;
+	bool _isUdpConfirmed = false;
+
+ public:
+	Packet* PopPacket() override
+	{
+		return _network.PopClientPacket(_clientIndex);
+	}
+
+	void SendPacket(Packet* packet, Protocol protocol) override
+	{
+		_network.SendToServer(packet, _clientIndex);
+	}
+
+	void SendUDPAcknowledgmentPacket() override
+	{
+		if (_isUdpConfirmed) return;
+
+		_network.ConfirmUdpConnection(_clientIndex);
+		_isUdpConfirmed = true;
+	}
+};
+
+/**
+ * @brief Inputs of a player in the replay, each held for a few frames, the same for a seed
+ */
+class InputScript
+{
+ public:
+	explicit InputScript(std::uint32_t seed) : _random(seed) {}
+
+ private:
+	std::mt19937 _random;
+	PlayerInput _input {};
+	int _framesLeft = 0;
+
+ public:
+	PlayerInput Next()
+	{
+		if (--_framesLeft <= 0)
+		{
+			_input = static_cast<PlayerInput>(_random() & 0b1111u);
+			_framesLeft = 5 + static_cast<int>(_random() % 25);
+		}
+
+		return _input;
+	}
+};
+
+/**
+ * @brief Play a replay of scripted inputs through the whole client, from the packets to the rollbacks and the geometry to render,
+ * against the game server in memory and without window <br>
+ * Usage: client_bench [frames] [latency in frames] [--offscreen] [--max-input-delay frames] [--predictor repeat-last|release-edges|pattern] <br>
+ * With --offscreen, the assets are loaded and each frame is drawn into a sf::RenderTexture, which needs an OpenGL context.
+ * Otherwise the frames are built but never drawn, the texts have no glyphs as the font needs OpenGL too
+ */
+int main(int argc, char* argv[])
+{
+	int frames = DEFAULT_FRAMES;
+	int latencyFrames = DEFAULT_LATENCY_FRAMES;
+	bool isOffscreen = false;
+	int maxInputDelay = MAX_INPUT_DELAY;
+	std::string_view predictorName = "repeat-last";
+	int position = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string_view argument = argv[i];
+
+		if (argument == "--offscreen")
+		{
+			isOffscreen = true;
+		}
+		else if (argument == "--max-input-delay" && i + 1 < argc)
+		{
+			maxInputDelay = std::stoi(argv[++i]);
+		}
+		else if (argument == "--predictor" && i + 1 < argc)
+		{
+			predictorName = argv[++i];
+		}
+		else if (position++ == 0)
+		{
+			frames = std::stoi(argv[i]);
+		}
+		else
+		{
+			latencyFrames = std::stoi(argv[i]);
+		}
+	}
+
+	MyPackets::RegisterMyPackets();
+
+	sf::RenderTexture renderTexture;
+
+	if (isOffscreen)
+	{
+		AssetManager::Initialize();
+
+		if (!renderTexture.create(static_cast<unsigned>(WIDTH.Value), static_cast<unsigned>(HEIGHT.Value)))
+		{
+			LOG_ERROR("Could not create the render texture, the frames are not drawn");
+			isOffscreen = false;
+		}
+	}
+
+	LocalNetwork network(latencyFrames);
+	GameServer server(network);
+
+	std::array<LocalClientNetwork, MAX_PLAYERS> clientNetworks = {
+		LocalClientNetwork(network, 0),
+		LocalClientNetwork(network, 1)
+	};
+	std::array<GameManager, MAX_PLAYERS> gameManagers = {
+		GameManager(WIDTH, HEIGHT),
+		GameManager(WIDTH, HEIGHT)
+	};
+	std::array<RollbackManager, MAX_PLAYERS> rollbackManagers = {
+		RollbackManager(),
+		RollbackManager()
+	};
+	std::array<Application, MAX_PLAYERS> applications = {
+		Application(rollbackManagers[0], gameManagers[0], clientNetworks[0], WIDTH, HEIGHT),
+		Application(rollbackManagers[1], gameManagers[1], clientNetworks[1], WIDTH, HEIGHT)
+	};
+	const RepeatLastInputPredictor repeatLastInputPredictor;
+	const ReleaseEdgesInputPredictor releaseEdgesInputPredictor;
+	const PatternInputPredictor patternInputPredictor;
+	const std::array<const InputPredictor*, 3> inputPredictors = { &repeatLastInputPredictor, &releaseEdgesInputPredictor, &patternInputPredictor };
+	const auto inputPredictor = std::find_if(inputPredictors.begin(), inputPredictors.end(), [predictorName](const InputPredictor* predictor) {
+		return predictor->GetName() == predictorName;
+	});
+
+	if (inputPredictor == inputPredictors.end())
+	{
+		LOG_ERROR("Unknown input predictor " << predictorName);
+		return EXIT_FAILURE;
+	}
+
+	for (auto& rollbackManager : rollbackManagers)
+	{
+		rollbackManager.SetMaxInputDelay(maxInputDelay);
+		rollbackManager.SetInputPredictor(**inputPredictor);
+	}
+
+	std::array<InputScript, MAX_PLAYERS> inputScripts = {
+		InputScript(1),
+		InputScript(2)
+	};
+
+	// Both clients join the lobby, the server starts the game when it is full
+	for (auto& application : applications)
+	{
+		application.JoinLobby();
+	}
+
+	const auto renderElapsed = sf::seconds(FIXED_TIME_STEP / RENDERS_PER_FIXED_UPDATE);
+	const auto mousePosition = sf::Vector2f(-1.f, -1.f);
+	std::vector<std::int64_t> frameTimes;
+	frameTimes.reserve(frames);
+
+	const auto runFrame = [&](std::size_t clientIndex) {
+		auto& application = applications[clientIndex];
+
+		application.AddLocalPlayerInput(inputScripts[clientIndex].Next());
+		application.FixedUpdate();
+
+		for (int render = 0; render < RENDERS_PER_FIXED_UPDATE; render++)
+		{
+			application.Update(renderElapsed, renderElapsed * static_cast<float>(render), mousePosition);
+
+			if (!isOffscreen || clientIndex != 0) continue;
+
+			renderTexture.clear();
+			application.Draw(renderTexture);
+			renderTexture.display();
+		}
+	};
+
+	// The game starts after a few round trips to the server, stop if it never does
+	for (int frame = 0; frames > 0 && frame < frames * 2; frame++)
+	{
+		network.NextFrame();
+
+		const auto isInGame = applications[0].GetState() == GameState::GAME;
+		const auto start = std::chrono::steady_clock::now();
+
+		runFrame(0);
+
+		const auto end = std::chrono::steady_clock::now();
+
+		runFrame(1);
+		server.Update();
+
+		// The frames of the menu and the lobby are not measured
+		if (!isInGame) continue;
+
+		frameTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+		if (static_cast<int>(frameTimes.size()) == frames) break;
+	}
+
+	if (frameTimes.empty())
+	{
+		LOG_ERROR("The game did not start");
+		return EXIT_FAILURE;
+	}
+
+	const auto mean = std::accumulate(frameTimes.begin(), frameTimes.end(), std::int64_t { 0 }) / static_cast<std::int64_t>(frameTimes.size());
+
+	std::sort(frameTimes.begin(), frameTimes.end());
+
+	const auto percentile = [&frameTimes](double ratio) {
+		const auto index = static_cast<std::size_t>(ratio * static_cast<double>(frameTimes.size() - 1));
+
+		return frameTimes[index] / 1'000.0;
+	};
+
+	LOG("Frames: " << frameTimes.size() << ", latency: " << latencyFrames << " frames, " << (isOffscreen ? "offscreen" : "headless"));
+	LOG("Frame time (us) mean: " << mean / 1'000.0
+		<< " p50: " << percentile(0.5) << " p90: " << percentile(0.9) << " p99: " << percentile(0.99)
+		<< " p99.9: " << percentile(0.999) << " max: " << frameTimes.back() / 1'000.0);
+
+	if (const auto* rollbackHistogram = Profiler::FindHistogram("Rollback::depth"))
+	{
+		const auto statistics = rollbackHistogram->Statistics();
+
+		LOG("Rollbacks: " << statistics.Count << ", depth p50: " << statistics.P50 << " p99: " << statistics.P99 << " max: " << statistics.Max);
+	}
+
+	LOG("Input delay: " << rollbackManagers[0].GetInputDelay() << " frames, max " << maxInputDelay
+		<< ", confirmation latency: " << rollbackManagers[0].GetConfirmationLatency() << " frames, average rollback depth: " << rollbackManagers[0].GetAverageRollbackDepth());
+	const auto& predictionStatistics = rollbackManagers[0].GetInputPredictionStatistics();
+	const auto mispredictionRate = predictionStatistics.Predictions == 0 ? 0.0
+		: static_cast<double>(predictionStatistics.Mispredictions) / static_cast<double>(predictionStatistics.Predictions);
+
+	LOG("Input predictor: " << predictorName << ", mispredictions: " << predictionStatistics.Mispredictions << " / " << predictionStatistics.Predictions
+		<< " (" << mispredictionRate * 100.0 << "%), rolled back frames: " << rollbackManagers[0].GetRolledBackFrames());
+	LOG("Skipped rollbacks: " << rollbackManagers[0].GetSkippedRollbackCount() << ", rollbacks: " << rollbackManagers[0].GetRollbackCount());
+	LOG("Stalled ticks: " << rollbackManagers[0].GetStallCount() << ", frame advantage: " << rollbackManagers[0].GetLocalFrameAdvantage());
+
+	Profiler::WriteFiles("client_bench_profile");
+	MemoryTracker::WriteFiles("client_bench_memory");
+
+	return EXIT_SUCCESS;
+}
@@ -1,6 +1,8 @@
 #include "GameServer.h"
 #include "PacketManager.h"
 #include "MyPackets.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
 
 int main()
 {
@@ -9,9 +11,18 @@ int main()
 	NetworkServerManager networkServerManager(PORT);
 	GameServer server(networkServerManager);
 
+	sf::Clock profilerClock;
+
 	while(networkServerManager.Running)
 	{
 		server.Update();
+
+		if (profilerClock.getElapsedTime().asSeconds() >= PROFILER_EXPORT_INTERVAL)
+		{
+			Profiler::WriteFiles("server_profile");
+			MemoryTracker::WriteFiles("server_memory");
+			profilerClock.restart();
+		}
 	}
 
 	return EXIT_SUCCESS;
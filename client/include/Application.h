@@ -42,7 +42,7 @@ class Application
 
 	void OnInput(const sf::Event& event);
 	/**
-	 * @brief Save local player input from current frame and send it to the server
+	 * @brief Save local player input, applied after the input delay of the RollbackManager, and send it to the server
 	 * @param playerInput
 	 */
 	void AddLocalPlayerInput(PlayerInput playerInput);
@@ -90,6 +90,14 @@ class Application
 	 * @return true if the game is running
 	 */
 	[[nodiscard]] bool IsRunning() const { return _running; }
+	/**
+	 * @brief Get the current state of the application, from the menu to the game
+	 */
+	[[nodiscard]] GameState GetState() const { return _state; }
+	/**
+	 * @brief Get the seconds to wait before the next fixed update, adjusted in game to stay in sync with the other client
+	 */
+	[[nodiscard]] float GetFixedTimeStep() const;
 
  private:
 	/**
@@ -144,11 +152,6 @@ class Application
 	 * @param packet The packet received
 	 */
 	void OnPacketReceived(Packet& packet);
-	/**
-	 * @brief Update the game state at a fixed rate
-	 * @param frame A frame number used to update the game state
-	 */
-	void UpdateGame(int frame);
 	/**
 	 * @brief Set the state of the game
 	 * @param state The state to set
@@ -13,6 +13,18 @@ constexpr float PLAYER_IDLE_FRAME_DURATION = 1.f / 6.f;
 constexpr float PLAYER_WALK_FRAME_DURATION = 1.f / 20.f;
 constexpr float PLAYER_JUMP_FRAME_DURATION = 1.f / 7.f;
 
+/**
+ * @brief Animations whose frames are in the texture atlas
+ */
+enum class AtlasAnimation
+{
+	PLAYER_IDLE,
+	PLAYER_WALK,
+	PLAYER_JUMP,
+	GHOST_IDLE,
+	COUNT
+};
+
 namespace AssetManager
 {
 	/**
@@ -22,21 +34,14 @@ namespace AssetManager
 
 	sf::Font& GetMainFont();
 	/**
-	 * @brief If frame is greater than PLAYER_IDLE_FRAMES, it will be set to frame % PLAYER_IDLE_FRAMES
-	 */
-	sf::Texture& GetPlayerIdleTexture(int frame);
-	/**
-	 * @brief If frame is greater than PLAYER_WALK_FRAMES, it will be set to frame % PLAYER_WALK_FRAMES
-	 */
-	sf::Texture& GetPlayerWalkTexture(int frame);
-	/**
-	 * @brief If frame is greater than PLAYER_JUMP_FRAMES, it will be set to frame % PLAYER_JUMP_FRAMES
+	 * @brief Texture with all the images of data/textures, to draw any of them without binding another texture
 	 */
-	sf::Texture& GetPlayerJumpTexture(int frame);
+	const sf::Texture& GetAtlasTexture();
 	/**
-	 * @brief If frame is greater than GHOST_IDLE_FRAMES, it will be set to frame % GHOST_IDLE_FRAMES
+	 * @brief Rectangle of a frame of an animation in the atlas texture <br>
+	 * If frame is greater than the frame count of the animation, it will be set to frame % frame count
 	 */
-	sf::Texture& GetGhostIdleTexture(int frame);
+	const sf::IntRect& GetTextureRect(AtlasAnimation animation, int frame);
 
 	bool IsInitialized();
 }
\ No newline at end of file
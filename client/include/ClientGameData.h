@@ -30,9 +30,9 @@ class ClientGameData final : public GameData
 	/**
 	 * @brief Update the animations of the players
 	 * @param elapsed  The time elapsed since the last update
-	 * @param elapsedSinceLastFixed  The time elapsed since the last fixed update
+	 * @param playerPositions  The positions to draw the players at, in the order of Players
 	 */
-	void UpdatePlayersAnimations(sf::Time elapsed, sf::Time elapsedSinceLastFixed);
+	void UpdatePlayersAnimations(sf::Time elapsed, const std::array<Math::Vec2F, MAX_PLAYERS>& playerPositions);
 
 	/**
 	 * @brief Set the inputs for the players, player1 is the local player, player2 is the remote player
@@ -47,4 +47,9 @@ class ClientGameData final : public GameData
 	 * @brief Called when the player and the ghost are switched, to update the role of the local player
 	 */
 	void OnSwitchPlayerAndGhost() override;
+
+	/**
+	 * @brief Keys of the remote player that can change the game at the next FixedUpdate, see GameData::GetRelevantInputs
+	 */
+	[[nodiscard]] PlayerInput GetRemoteRelevantInputs(bool asPreviousInput) const;
 };
\ No newline at end of file
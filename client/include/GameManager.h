@@ -4,13 +4,15 @@
 #include "Packet.h"
 #include "PlayerInputs.h"
 #include "ClientGameData.h"
+#include "RenderInterpolation.h"
+#include "RollbackManager.h"
 
 #include <queue>
 
 /**
  * @brief Manage the game
  */
-class GameManager
+class GameManager final : public RollbackSimulation
 {
  public:
 	/**
@@ -25,6 +27,10 @@ class GameManager
 	 * @brief The current game data
 	 */
 	ClientGameData _gameData;
+	/**
+	 * @brief Positions of the last two fixed updates, to draw the game between them
+	 */
+	RenderInterpolation _renderInterpolation;
 
 	/**
 	 * @brief The width of the screen
@@ -57,20 +63,32 @@ class GameManager
 	 */
 	void FixedUpdate(PlayerInput player1Input, PlayerInput player1PreviousInput, PlayerInput player2Input, PlayerInput player2PreviousInput);
 	/**
-	 * @brief Update the player animations
+	 * @brief Update the player animations, the players are placed between their positions of the last two fixed updates
 	 * @param elapsed  the elapsed time
 	 * @param elapsedSinceLastFixed  the elapsed time since the last fixed update
 	 */
 	void UpdatePlayerAnimations(sf::Time elapsed, sf::Time elapsedSinceLastFixed);
+	/**
+	 * @brief Save the positions of the game data to draw them, once per fixed update after the rollback and the update of the current frame
+	 */
+	void SaveRenderTransforms();
 
 	/**
-	 * @brief Get the game data
-	 * @return the game data
+	 * @brief Get the game data, read-only and without copy
+	 * @return the game data, valid as long as the game manager
+	 */
+	[[nodiscard]] const ClientGameData& GetGameData() const override;
+	[[nodiscard]] const RenderInterpolation& GetRenderInterpolation() const { return _renderInterpolation; }
+	/**
+	 * @brief Set the game data, copied into the buffers of the current game data so it does not allocate once they are big enough
+	 * @param gameData the game data, a snapshot of the rollback manager
 	 */
-	[[nodiscard]] ClientGameData GetGameData() const;
+	void SetGameData(const ClientGameData& gameData) override;
 	/**
-	 * @brief Set the game data
-	 * @param gameData the game data
+	 * @brief Update the game, and the player animations for the frames simulated again by a rollback
+	 * @param inputs the inputs of the players
+	 * @param previousInputs the inputs of the players at the previous frame
+	 * @param isRollback true if the frame is simulated by a rollback
 	 */
-	void SetGameData(ClientGameData gameData);
+	void SimulateFrame(FinalInputs inputs, FinalInputs previousInputs, bool isRollback) override;
 };
\ No newline at end of file
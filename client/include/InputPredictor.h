@@ -0,0 +1,87 @@
+#pragma once
+
+#include "PlayerInputs.h"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+/**
+ * @brief Most known inputs given to a predictor, the oldest first
+ */
+constexpr std::size_t INPUT_PREDICTION_HISTORY = 32;
+
+/**
+ * @brief Predicts the inputs of the other player for the frames its inputs did not arrive yet <br>
+ * A prediction only depends on the known inputs, so a frame is predicted the same until its input arrives
+ */
+class InputPredictor
+{
+ public:
+	virtual ~InputPredictor() = default;
+
+	/**
+	 * @brief Predict the input of a frame after the last known one
+	 * @param history Last known inputs of the player, the oldest first, never empty
+	 * @param framesAhead Frames between the last known input and the predicted one, 1 for the frame just after it
+	 */
+	[[nodiscard]] virtual PlayerInput Predict(std::span<const PlayerInput> history, int framesAhead) const = 0;
+	[[nodiscard]] virtual std::string_view GetName() const = 0;
+};
+
+/**
+ * @brief The keys stay as they were at the last known input
+ */
+class RepeatLastInputPredictor final : public InputPredictor
+{
+ public:
+	[[nodiscard]] PlayerInput Predict(std::span<const PlayerInput> history, int framesAhead) const override;
+	[[nodiscard]] std::string_view GetName() const override { return "repeat-last"; }
+};
+
+/**
+ * @brief Like repeat-last, but the edge-triggered keys pressed for a tap are released when the tap ends <br>
+ * The ghost reacts only to the presses of its keys, which are tapped rather than held
+ */
+class ReleaseEdgesInputPredictor final : public InputPredictor
+{
+ public:
+	/**
+	 * @param edgeKeys Keys released at the end of a tap, the ghost keys by default
+	 * @param tapFrames Most frames a key is held for a tap, a key held longer is held until its release arrives
+	 */
+	explicit ReleaseEdgesInputPredictor(PlayerInput edgeKeys = static_cast<PlayerInput>(PlayerInputTypes::Left)
+		| static_cast<PlayerInput>(PlayerInputTypes::Right) | static_cast<PlayerInput>(PlayerInputTypes::Down), int tapFrames = 3);
+
+ private:
+	PlayerInput _edgeKeys;
+	int _tapFrames;
+
+ public:
+	[[nodiscard]] PlayerInput Predict(std::span<const PlayerInput> history, int framesAhead) const override;
+	[[nodiscard]] std::string_view GetName() const override { return "release-edges"; }
+};
+
+/**
+ * @brief Find the last time the last inputs were played before and predict what followed them, repeat-last without such a pattern
+ */
+class PatternInputPredictor final : public InputPredictor
+{
+ public:
+	/**
+	 * @param patternLength Number of last inputs to find earlier in the history
+	 */
+	explicit PatternInputPredictor(int patternLength = 3);
+
+	/**
+	 * @brief Most frames predicted one after the other, the frames after it are predicted the same
+	 */
+	static constexpr int MAX_PREDICTED_FRAMES = 8;
+
+ private:
+	int _patternLength;
+
+ public:
+	[[nodiscard]] PlayerInput Predict(std::span<const PlayerInput> history, int framesAhead) const override;
+	[[nodiscard]] std::string_view GetName() const override { return "pattern"; }
+};
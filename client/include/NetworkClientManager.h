@@ -2,6 +2,7 @@
 
 #include "Packet.h"
 #include "ClientNetworkInterface.h"
+#include "Allocator.h"
 
 #include <shared_mutex>
 #include <queue>
@@ -21,9 +22,13 @@ private:
 	sf::TcpSocket* _socket = new sf::TcpSocket();
 	sf::UdpSocket _udpSocket;
 
-	std::queue<Packet*> _packetReceived;
+	// The queues are filled and emptied by different threads, counted in the network memory
+	HeapAllocator _heapAllocator;
+	ThreadCacheAllocator _queueAllocator {_heapAllocator, MemoryTag::Network};
+
+	std::queue<Packet*, MyDeque<Packet*>> _packetReceived { MyDeque<Packet*> { StandardAllocator<Packet*> {_queueAllocator} } };
 	mutable std::shared_mutex _receivedMutex;
-	std::queue<PacketProtocol> _packetToSend;
+	std::queue<PacketProtocol, MyDeque<PacketProtocol>> _packetToSend { MyDeque<PacketProtocol> { StandardAllocator<PacketProtocol> {_queueAllocator} } };
 	mutable std::shared_mutex _sendMutex;
 	bool _running = true;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Constants.h"
+#include "Renderer/SpriteBatch.h"
 
 #include "SFML/Graphics.hpp"
 
@@ -18,9 +19,9 @@ enum class PlayerDirection
 };
 
 /**
- * Used to manage player animations and sprite
+ * Used to manage player animations and sprite, the sprite is drawn with the others from a SpriteBatch of the texture atlas
  */
-class PlayerDrawable : public sf::Drawable
+class PlayerDrawable
 {
  public:
 	PlayerDrawable() = default;
@@ -35,10 +36,13 @@ class PlayerDrawable : public sf::Drawable
 	int _frame = 0;
 	bool _isLocalPlayer = false;
 
-	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
-
  public:
 	void Update(sf::Time elapsed);
+	/**
+	 * Add the sprite of the current animation frame to a batch of the texture atlas
+	 * @param spriteBatch the batch to add the sprite to
+	 */
+	void AddTo(SpriteBatch& spriteBatch) const;
 
 	/**
 	 * Set player role and color based on role
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "GameData.h"
+#include "Constants.h"
+
+#include "Vec2.h"
+
+#include <SFML/System/Time.hpp>
+
+#include <array>
+
+/**
+ * @brief Positions of the players and the bricks at the last two fixed updates, blended by the time elapsed since the last one <br>
+ * The game is drawn one fixed update late, but moves smoothly at any frame rate, even with a low PHYSICAL_FRAME_RATE
+ */
+class RenderInterpolation
+{
+ public:
+	RenderInterpolation() = default;
+
+	/**
+	 * @brief A move longer than this in one fixed update is a teleport, like the player placed back on the platform, it is drawn at once instead of blended
+	 */
+	static constexpr float SNAP_DISTANCE = 200.f;
+
+ private:
+	struct Transforms
+	{
+		/**
+		 * @brief Position of the player then of the ghost, in the order of ClientGameData::Players
+		 */
+		std::array<Math::Vec2F, MAX_PLAYERS> PlayerPositions {};
+		std::array<std::array<Math::Vec2F, MAX_BRICKS_PER_COLUMN>, HAND_SLOT_COUNT> BrickPositions {};
+		std::array<std::array<bool, MAX_BRICKS_PER_COLUMN>, HAND_SLOT_COUNT> IsBrickAlive {};
+	};
+
+	/**
+	 * @brief Transforms of the previous and the current fixed update, the current one is at _current
+	 */
+	std::array<Transforms, 2> _transforms {};
+	std::size_t _current = 0;
+	/**
+	 * @brief False until the first fixed update after a reset, there is nothing to blend with before
+	 */
+	bool _hasTransforms = false;
+
+	[[nodiscard]] const Transforms& previous() const { return _transforms[1 - _current]; }
+	[[nodiscard]] const Transforms& current() const { return _transforms[_current]; }
+
+	static Math::Vec2F blend(Math::Vec2F previousPosition, Math::Vec2F currentPosition, float alpha);
+
+ public:
+	/**
+	 * @brief Save the transforms of a fixed update, the current ones become the previous ones
+	 * @param gameData Game data after the fixed update, and after the rollback if there was one
+	 */
+	void Push(const GameData& gameData);
+	/**
+	 * @brief Forget the saved transforms, the next push is drawn without blending
+	 */
+	void Reset();
+
+	/**
+	 * @param playerIndex Index in ClientGameData::Players, 0 for the player and 1 for the ghost
+	 * @param alpha 0 for the previous fixed update, 1 for the last one
+	 */
+	[[nodiscard]] Math::Vec2F GetPlayerPosition(std::size_t playerIndex, float alpha) const;
+	/**
+	 * @brief Position of the collider of a brick, the last one if it was not alive at the previous fixed update
+	 * @param alpha 0 for the previous fixed update, 1 for the last one
+	 */
+	[[nodiscard]] Math::Vec2F GetBrickPosition(int handIndex, int brickIndex, float alpha) const;
+
+	/**
+	 * @brief Blend factor of the time elapsed since the last fixed update, between 0 and 1
+	 */
+	static float GetAlpha(sf::Time elapsedSinceLastFixed);
+};
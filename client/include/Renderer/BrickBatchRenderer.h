@@ -0,0 +1,88 @@
+#pragma once
+
+#include "GameData.h"
+#include "RenderInterpolation.h"
+#include "Constants.h"
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+
+/**
+ * @brief Draw the platform and all the bricks in one draw call, from a single vertex array <br>
+ * The vertices of a brick are only rewritten when it spawns, dies, moves or is resized since the last update
+ */
+class BrickBatchRenderer final : public sf::Drawable
+{
+ public:
+	BrickBatchRenderer();
+
+	/**
+	 * @brief Vertices of a rectangle, its outline then its fill drawn over it, as two triangles each
+	 */
+	static constexpr std::size_t VERTICES_PER_RECTANGLE = 12;
+	/**
+	 * @brief Number of brick slots, the bricks of a hand slot follow each other
+	 */
+	static constexpr std::size_t BRICK_COUNT = HAND_SLOT_COUNT * MAX_BRICKS_PER_COLUMN;
+	static constexpr float BRICK_OUTLINE_THICKNESS = 1.f;
+	static constexpr float PLATFORM_OUTLINE_THICKNESS = 2.f;
+
+ private:
+	/**
+	 * @brief State of a brick when its vertices were written, to know if they need to be written again
+	 */
+	struct BrickState
+	{
+		bool IsAlive = false;
+		Math::Vec2F Position;
+		Math::Vec2F Size;
+	};
+
+	/**
+	 * @brief The platform first, then the bricks, the dead bricks have degenerated triangles that draw nothing
+	 */
+	sf::VertexArray _vertices;
+	std::array<BrickState, BRICK_COUNT> _brickStates {};
+	std::size_t _lastUpdatedBrickCount = 0;
+
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+ public:
+	/**
+	 * @brief Set the geometry of the platform, it does not move during a game
+	 * @param center Center of the platform in pixels
+	 * @param size Size of the platform in pixels
+	 */
+	void SetPlatform(sf::Vector2f center, sf::Vector2f size);
+	/**
+	 * @brief Rewrite the vertices of the bricks that changed since the last update
+	 * @param gameData Game data to read the bricks from
+	 * @param renderInterpolation Positions of the bricks at the last two fixed updates
+	 * @param alpha Blend factor between the two fixed updates
+	 */
+	void Update(const GameData& gameData, const RenderInterpolation& renderInterpolation, float alpha);
+
+	[[nodiscard]] const sf::VertexArray& GetVertices() const { return _vertices; }
+	/**
+	 * @brief Number of bricks whose vertices were rewritten by the last update
+	 */
+	[[nodiscard]] std::size_t GetLastUpdatedBrickCount() const { return _lastUpdatedBrickCount; }
+
+	/**
+	 * @brief Write the vertices of a rectangle with an outline inside its bounds, like a sf::RectangleShape with a negative outline thickness
+	 * @param vertices First of the VERTICES_PER_RECTANGLE vertices to write
+	 * @param center Center of the rectangle
+	 * @param size Size of the rectangle, outline included
+	 * @param outlineThickness Thickness of the outline
+	 * @param fillColor Color inside the outline
+	 * @param outlineColor Color of the outline
+	 */
+	static void WriteRectangle(sf::Vertex* vertices, sf::Vector2f center, sf::Vector2f size, float outlineThickness,
+		sf::Color fillColor, sf::Color outlineColor);
+	/**
+	 * @brief Write the vertices of a rectangle that draws nothing
+	 * @param vertices First of the VERTICES_PER_RECTANGLE vertices to write
+	 */
+	static void ClearRectangle(sf::Vertex* vertices);
+};
@@ -65,6 +65,10 @@ public:
 	virtual void OnEndHover();
 
 	void SetText(const std::vector<TextLine>& texts);
+	/**
+	 * @brief Add the text to a batch, the button itself only draws its background
+	 */
+	void AddTextTo(GlyphBatch& glyphBatch) const;
 
 	sf::FloatRect GetGlobalBounds() const;
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Renderer/TextLayoutCache.h"
+
+#include <SFML/Graphics.hpp>
+
+#include <vector>
+
+/**
+ * @brief Glyphs of many texts drawn with the main font, one vertex array and one draw call per character size <br>
+ * The font has one texture per character size, so the texts of a size are all drawn together
+ */
+class GlyphBatch final : public sf::Drawable
+{
+ public:
+	GlyphBatch() = default;
+
+ private:
+	struct Page
+	{
+		unsigned CharacterSize;
+		sf::VertexArray Vertices;
+	};
+
+	/**
+	 * @brief Kept between two clears with their vertices, so filling the batch every frame does not allocate
+	 */
+	std::vector<Page> _pages;
+
+	sf::VertexArray& page(unsigned characterSize);
+
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+ public:
+	/**
+	 * @brief Remove all the glyphs
+	 */
+	void Clear();
+	/**
+	 * @brief Add the glyphs of a layout
+	 * @param layout Layout from the TextLayoutCache
+	 * @param offset Position of the origin of the layout
+	 * @param color Color of the glyphs
+	 */
+	void Add(const TextLayout& layout, sf::Vector2f offset, sf::Color color);
+	/**
+	 * @brief Add all the glyphs of another batch, already placed and colored
+	 */
+	void Add(const GlyphBatch& other);
+	void SetColor(sf::Color color);
+
+	/**
+	 * @brief Number of draw calls to draw the batch, one per character size with glyphs
+	 */
+	[[nodiscard]] std::size_t GetDrawCallCount() const;
+	[[nodiscard]] std::size_t GetVertexCount() const;
+};
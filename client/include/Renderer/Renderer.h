@@ -3,6 +3,7 @@
 #include "Button.h"
 #include "Text.h"
 #include "Event.h"
+#include "Renderer/GlyphBatch.h"
 
 #include <SFML/Graphics.hpp>
 
@@ -24,9 +25,14 @@ protected:
 	 * @brief Texts to display on the screen
 	 */
 	std::vector<Text> _texts;
+	/**
+	 * @brief Glyphs of the buttons and the texts, filled again after each update and drawn in one draw call per character size
+	 */
+	GlyphBatch _glyphBatch;
 
 	/**
-	 * @brief Draw the renderer on the screen and all its elements (buttons and texts), it calls OnDraw to draw additional elements from the derived class
+	 * @brief Draw the renderer on the screen and all its elements (buttons and texts), it calls OnDraw to draw additional elements from the derived class <br>
+	 * The texts are drawn over the buttons, from the glyph batch
 	 * @param target Render target to draw on
 	 * @param states Render states to use
 	 */
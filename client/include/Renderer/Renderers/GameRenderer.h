@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Renderer/Renderer.h"
+#include "Renderer/BrickBatchRenderer.h"
+#include "Renderer/SpriteBatch.h"
 #include "Constants.h"
 
 class Application;
@@ -31,6 +33,15 @@ class GameRenderer final :
 	 */
 	ScreenSizeValue _width;
 
+	/**
+	 * @brief Platform and bricks, updated with the game data every frame and drawn in one draw call
+	 */
+	BrickBatchRenderer _brickBatch;
+	/**
+	 * @brief Sprites of the players from the texture atlas, filled again every frame and drawn in one draw call
+	 */
+	SpriteBatch _spriteBatch;
+
 	/**
 	 * @brief Texts to display on the screen at the start of the game from the player's perspective
 	 */
@@ -50,6 +61,15 @@ class GameRenderer final :
 	static constexpr float MESSAGE_TIMER = 6.f;
 	float _messageTimer = 0;
 
+	/**
+	 * @brief Index in the texts of the countdown shown while the players are frozen
+	 */
+	static constexpr std::size_t FREEZE_TEXT_INDEX = 1;
+	/**
+	 * @brief Tenths of seconds shown by the countdown, -1 when it is hidden, the text is only rebuilt when it changes
+	 */
+	int _shownFreezeTime = -1;
+
 	/**
 	 * @brief Texts to display on the screen at the end of the game
 	 */
@@ -83,7 +103,7 @@ class GameRenderer final :
 
 	/**
 	 * @brief Update the game renderer <br>
-	 * It updates the message timer, texts and players animations
+	 * It updates the message timer, the freeze countdown, texts and players animations
 	 *
 	 * @param elapsed Time elapsed since the last update
 	 * @param elapsedSinceLastFixed Time elapsed since the last fixed update
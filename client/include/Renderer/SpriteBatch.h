@@ -0,0 +1,43 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+/**
+ * @brief Sprites of one texture, like the texture atlas, drawn in one draw call from a single vertex array <br>
+ * The vertices are kept between two clears, so adding the same number of sprites every frame does not allocate
+ */
+class SpriteBatch final : public sf::Drawable
+{
+ public:
+	explicit SpriteBatch(const sf::Texture* texture = nullptr);
+
+	/**
+	 * @brief Vertices of a sprite, two triangles
+	 */
+	static constexpr std::size_t VERTICES_PER_SPRITE = 6;
+
+ private:
+	const sf::Texture* _texture;
+	sf::VertexArray _vertices;
+
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+ public:
+	/**
+	 * @brief Remove all the sprites, to add the sprites of the next frame
+	 */
+	void Clear();
+	/**
+	 * @brief Add a sprite, transformed like a sf::Sprite with the same origin, position and scale
+	 * @param textureRect Part of the texture to draw
+	 * @param position Position of the origin of the sprite
+	 * @param origin Origin of the sprite, relative to its top left corner, before the scale
+	 * @param scale Scale of the sprite, a negative scale flips it
+	 * @param color Color multiplied with the texture
+	 */
+	void Add(const sf::IntRect& textureRect, sf::Vector2f position, sf::Vector2f origin, sf::Vector2f scale, sf::Color color);
+
+	void SetTexture(const sf::Texture* texture) { _texture = texture; }
+	[[nodiscard]] const sf::VertexArray& GetVertices() const { return _vertices; }
+	[[nodiscard]] std::size_t GetSpriteCount() const { return _vertices.getVertexCount() / VERTICES_PER_SPRITE; }
+};
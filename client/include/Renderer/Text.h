@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Renderer/GlyphBatch.h"
+
 #include <SFML/Graphics.hpp>
 
 struct CustomText
@@ -8,8 +10,6 @@ struct CustomText
 	sf::Color Color{ sf::Color::Cyan };
 	sf::Text::Style Style{ sf::Text::Style::Regular };
 	int Size{ 12 };
-
-	[[nodiscard]] sf::Text ToSfText() const;
 };
 
 struct TextLine
@@ -17,6 +17,9 @@ struct TextLine
 	std::vector<CustomText> Texts;
 };
 
+/**
+ * @brief Lines of texts laid out once with the TextLayoutCache, the glyphs are placed when it is constructed
+ */
 class Text : public sf::Drawable
 {
 public:
@@ -24,7 +27,7 @@ public:
 	Text(sf::Vector2f position, const std::vector<TextLine>& texts, float maxX = -1, bool centered = true);
 
 protected:
-	std::vector<sf::Text> _texts;
+	GlyphBatch _glyphs;
 	bool _centered{ false };
 
 	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
@@ -33,4 +36,8 @@ public:
 	virtual void Update(sf::Time elapsed) {}
 
 	void SetColor(const sf::Color& color);
+	/**
+	 * @brief Add the glyphs to a batch, to draw them with the other texts of the screen
+	 */
+	void AddTo(GlyphBatch& glyphBatch) const;
 };
\ No newline at end of file
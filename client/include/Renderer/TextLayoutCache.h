@@ -0,0 +1,52 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Glyph quads of a string laid out like a sf::Text at the origin, in white so any color can be applied when drawing it
+ */
+struct TextLayout
+{
+	/**
+	 * @brief Two triangles per glyph, the texture coordinates are in the font texture of CharacterSize
+	 */
+	std::vector<sf::Vertex> Vertices;
+	/**
+	 * @brief Same as the local bounds of a sf::Text with the same string, size and style
+	 */
+	sf::FloatRect Bounds;
+	unsigned CharacterSize = 0;
+};
+
+/**
+ * @brief Layouts of the strings drawn with the main font, computed the first time a string is drawn with a size and a style
+ */
+namespace TextLayoutCache
+{
+	/**
+	 * @brief Get the layout of a string, laid out once then reused, the reference stays valid until Clear
+	 * @param string Text to lay out, it can contain spaces, tabs and new lines
+	 * @param characterSize Size of the characters in pixels
+	 * @param style Style of the text, only bold and italic change the layout
+	 * @return The layout, empty if the AssetManager is not initialized
+	 */
+	const TextLayout& Get(const std::string& string, unsigned characterSize, sf::Text::Style style);
+
+	using LayoutFunction = TextLayout (*)(const std::string& string, unsigned characterSize, sf::Text::Style style);
+
+	/**
+	 * @brief Get the layout of a string, laid out by a function the first time, the reference stays valid until Clear
+	 * @param layoutFunction Function laying out a string that is not in the cache yet
+	 */
+	const TextLayout& Get(const std::string& string, unsigned characterSize, sf::Text::Style style, LayoutFunction layoutFunction);
+	/**
+	 * @brief Lay out a string without caching it, like sf::Text does
+	 */
+	TextLayout Layout(const sf::Font& font, const std::string& string, unsigned characterSize, sf::Text::Style style);
+
+	[[nodiscard]] std::size_t GetSize();
+	void Clear();
+}
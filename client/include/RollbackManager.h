@@ -4,7 +4,12 @@
 #include "Packet.h"
 #include "Constants.h"
 #include "ClientGameData.h"
+#include "Allocator.h"
+#include "InputPredictor.h"
 
+#include <array>
+#include <cstdint>
+#include <optional>
 #include <vector>
 
 struct ConfirmedFrame
@@ -13,48 +18,271 @@ struct ConfirmedFrame
 	Checksum Checksum {};
 };
 
+/**
+ * @brief Game data after a frame was simulated
+ */
+struct GameDataSnapshot
+{
+	ClientGameData GameData;
+	int Frame = -1;
+};
+
+/**
+ * @brief How well the input predictor guessed the remote inputs of the frames simulated before they arrived
+ */
+struct InputPredictionStatistics
+{
+	std::uint64_t Predictions = 0;
+	std::uint64_t Mispredictions = 0;
+};
+
+/**
+ * @brief Game simulated by the RollbackManager one frame after the other, started again from a snapshot on a rollback
+ */
+class RollbackSimulation
+{
+ public:
+	virtual ~RollbackSimulation() = default;
+
+	/**
+	 * @brief Start again from the game data of a snapshot
+	 */
+	virtual void SetGameData(const ClientGameData& gameData) = 0;
+	[[nodiscard]] virtual const ClientGameData& GetGameData() const = 0;
+	/**
+	 * @brief Simulate the next frame
+	 * @param isRollback True for the frames simulated by a rollback, false for the current frame
+	 */
+	virtual void SimulateFrame(FinalInputs inputs, FinalInputs previousInputs, bool isRollback) = 0;
+};
+
 class RollbackManager
 {
  public:
 	RollbackManager();
 
  private:
-	// PlayerDrawable inputs from my player (ghost or player role) from confirm frame
-	std::vector<PlayerInput> _localPlayerInputs;
-	std::vector<PlayerInputPerFrame> _lastRemotePlayerInputs;
+	// Counted in the rollback memory, the confirmed frames grow for the whole game
+	HeapAllocator _heapAllocator {MemoryTag::Rollback};
+
+	// PlayerDrawable inputs from my player (ghost or player role) from confirm frame, the last _inputDelay ones are for the next frames
+	MyVector<PlayerInput> _localPlayerInputs { StandardAllocator<PlayerInput> {_heapAllocator} };
+	// Local tick at which each local input was sent, to measure how long the server takes to confirm it
+	MyVector<int> _localInputTicks { StandardAllocator<int> {_heapAllocator} };
+	MyVector<PlayerInputPerFrame> _lastRemotePlayerInputs { StandardAllocator<PlayerInputPerFrame> {_heapAllocator} };
 
 	// Confirmed player inputs from server (ghost and player role)
-	std::vector<ConfirmedFrame> _confirmedFrames;
+	MyVector<ConfirmedFrame> _confirmedFrames { StandardAllocator<ConfirmedFrame> {_heapAllocator} };
 
 	// GameData at confirmed frame
 	ClientGameData _confirmedGameData;
-	std::vector<ClientGameData> _unconfirmedGameData;
-	int _lastConfirmedFrame = -1;
+	// Frame simulated to get the confirmed game data, -1 until it is known. The rollbacks simulate again from the frame after it
+	int _confirmedGameDataFrame = -1;
+	// GameData of the frames not confirmed yet, a ring from the oldest one. The slots are kept when their frame is confirmed
+	// or rolled back, so the next snapshots are copied into their buffers without allocating
+	MyVector<GameDataSnapshot> _unconfirmedGameData { StandardAllocator<GameDataSnapshot> {_heapAllocator} };
+	std::size_t _unconfirmedGameDataStart = 0;
+	std::size_t _unconfirmedGameDataCount = 0;
 
 	PlayerNumber _localPlayerNumber = PlayerNumber::PLAYER1;
 	bool _needToRollback = false;
 	bool _integrityIsOk = true;
 
+	// Frames between reading a local input and applying it, adapted to the confirmation latency up to _maxInputDelay
+	int _inputDelay = 0;
+	int _maxInputDelay = MAX_INPUT_DELAY;
+	int _localTick = 0;
+	int _lastInputDelayChangeTick = 0;
+	// Keys of the local inputs read while the current frame did not advance, added to the next input
+	PlayerInput _pendingLocalInput {};
+	// Smoothed number of local ticks between sending a local input and receiving its confirmation, negative until measured
+	float _confirmationLatency = -1.f;
+
+	std::uint64_t _rollbackCount = 0;
+	std::uint64_t _rolledBackFrames = 0;
+	std::uint64_t _stallCount = 0;
+	std::uint64_t _skippedRollbackCount = 0;
+
+	// Remote inputs the frames from _simulatedRemoteInputsFirstFrame were simulated with, saved before new remote inputs are added,
+	// a negative count when there were too many frames to save them
+	std::array<PlayerInput, MAX_PREDICTION_FRAMES + 1> _simulatedRemoteInputs {};
+	int _simulatedRemoteInputsFirstFrame = 0;
+	int _simulatedRemoteInputsCount = 0;
+
+	// Not owned, the repeat-last predictor by default
+	const InputPredictor* _inputPredictor;
+	InputPredictionStatistics _inputPredictionStatistics;
+
+	// Last frame the game was simulated to, the current frame is not simulated again while the client waits for confirmations
+	int _lastSimulatedFrame = -1;
+
+	// Last frame and frame advantage sent by the other client, -1 until its first inputs
+	int _remoteFrame = -1;
+	int _remoteFrameAdvantage = 0;
+
 public:
 	void OnPacketReceived(Packet& packet);
 
+	/**
+	 * @brief Add the local input read this frame, applied _inputDelay frames later. When the delay grows, the last input is repeated
+	 * for the frame in between, when it shrinks, the next frame already has an input and this one is added to the next input. <br>
+	 * The current frame does not change either when MAX_PREDICTION_FRAMES are not confirmed yet, the input is added to the next one too
+	 */
 	void AddPlayerInputs(PlayerInput playerInput);
 	std::vector<PlayerInputPerFrame> GetLastLocalPlayerInputs();
 
+	/**
+	 * @brief Get the input of a player at a frame. The local inputs after the last one are the same,
+	 * the remote inputs not received yet are predicted by the input predictor
+	 */
 	[[nodiscard]] PlayerInput GetPlayerInput(PlayerNumber playerNumber, int frame) const;
 
 	[[nodiscard]] short GetCurrentFrame() const;
+	/**
+	 * @brief Number of frames simulated past the last confirmed one, up to MAX_PREDICTION_FRAMES
+	 */
+	[[nodiscard]] int GetPredictedFrameCount() const;
+	/**
+	 * @brief Frames the local client is ahead of the other one, from the last frame it sent
+	 */
+	[[nodiscard]] int GetLocalFrameAdvantage() const;
+	/**
+	 * @brief Duration of the next fixed update, FIXED_TIME_STEP stretched when the local client is ahead of the other one
+	 * and shortened when it is behind, so both drift toward the same frame advantage
+	 */
+	[[nodiscard]] float GetFixedTimeStep() const;
 
-	void SetConfirmedGameData(ClientGameData gameData);
-	[[nodiscard]] ClientGameData GetConfirmedGameData() const;
+	/**
+	 * @brief Copy the game data of the next confirmed frame into the confirmed snapshot
+	 * @param frame Frame simulated to get the game data
+	 */
+	void SetConfirmedGameData(const ClientGameData& gameData, int frame);
+	/**
+	 * @brief Get the confirmed snapshot, read-only and without copy
+	 */
+	[[nodiscard]] const ClientGameData& GetConfirmedGameData() const;
+	/**
+	 * @brief Frame after the one of the confirmed game data, the first frame a rollback simulates
+	 */
 	[[nodiscard]] int GetConfirmedFrame() const;
+	/**
+	 * @brief Last frame a rollback simulates, the one before the current frame, or the last confirmed frame when it was
+	 * confirmed before being simulated
+	 */
+	[[nodiscard]] int GetLastRollbackFrame() const;
 	[[nodiscard]] short GetConfirmedInputFrame() const;
 
 	void ResetUnconfirmedGameData();
-	void AddUnconfirmedGameData(ClientGameData gameData);
+	/**
+	 * @brief Copy the game data of the next unconfirmed frame into a snapshot, reusing the slot of a confirmed or rolled back frame
+	 * @param frame Frame simulated to get the game data
+	 */
+	void AddUnconfirmedGameData(const ClientGameData& gameData, int frame);
+
+	/**
+	 * @brief Simulate the frames of a fixed update: on a rollback, again from the confirmed game data up to the last rollback frame,
+	 * then the current frame if it was not simulated yet. The game data of each frame is saved as a snapshot
+	 */
+	void SimulateFrames(RollbackSimulation& simulation);
 
 	[[nodiscard]] bool NeedToRollback() const;
-	void RollbackDone();
+	/**
+	 * @brief Called after the game has been simulated again from the confirmed frame
+	 * @param depth Number of frames simulated again, 0 when only frames confirmed before being simulated were simulated, which is not a rollback
+	 */
+	void RollbackDone(int depth);
+
+	/**
+	 * @brief Set the most frames a local input can be delayed by, 0 applies the local inputs at the frame they are read
+	 */
+	void SetMaxInputDelay(int maxInputDelay);
+	[[nodiscard]] int GetInputDelay() const;
+	/**
+	 * @brief Average number of local ticks between sending a local input and receiving its confirmation
+	 */
+	[[nodiscard]] float GetConfirmationLatency() const;
+	/**
+	 * @brief Set the predictor of the remote inputs, it must outlive the RollbackManager
+	 */
+	void SetInputPredictor(const InputPredictor& inputPredictor);
+	[[nodiscard]] const InputPredictor& GetInputPredictor() const;
+	[[nodiscard]] const InputPredictionStatistics& GetInputPredictionStatistics() const;
+
+	[[nodiscard]] std::uint64_t GetRollbackCount() const;
+	/**
+	 * @brief Number of remote inputs that differed from the ones simulated without changing the game, so without rollback
+	 */
+	[[nodiscard]] std::uint64_t GetSkippedRollbackCount() const;
+	/**
+	 * @brief Total number of frames simulated again by the rollbacks
+	 */
+	[[nodiscard]] std::uint64_t GetRolledBackFrames() const;
+	/**
+	 * @brief Number of ticks the local client waited for the confirmations, the prediction window being full
+	 */
+	[[nodiscard]] std::uint64_t GetStallCount() const;
+	/**
+	 * @brief Average number of frames simulated again per rollback, 0 without rollback
+	 */
+	[[nodiscard]] float GetAverageRollbackDepth() const;
 
 	void CheckIntegrity(int frame);
+
+private:
+	/**
+	 * @brief Simulate a frame with the inputs of the players at it and at the frame before
+	 */
+	void simulateFrame(RollbackSimulation& simulation, int frame, bool isRollback) const;
+	/**
+	 * @brief Number of frames with a known input of the player, confirmed, local or received from the other player
+	 */
+	[[nodiscard]] std::size_t getKnownInputCount(PlayerNumber playerNumber) const;
+	[[nodiscard]] PlayerInput getKnownInput(PlayerNumber playerNumber, std::size_t frame) const;
+	/**
+	 * @brief Predict the remote input of a frame from the first inputs known of the player
+	 * @param knownCount Number of known inputs to predict from, at least one
+	 */
+	[[nodiscard]] PlayerInput predictRemoteInput(PlayerNumber playerNumber, int frame, std::size_t knownCount) const;
+	/**
+	 * @brief Count a remote input received for a frame, if the frame was already simulated with a prediction. The prediction is
+	 * the saved input the frame was simulated with, the one getSimulationChange compares too
+	 */
+	void addPrediction(int frame, PlayerInput input);
+
+	enum class SimulationChange
+	{
+		NONE,
+		IRRELEVANT,
+		RELEVANT
+	};
+
+	/**
+	 * @brief Save the remote inputs of the frames simulated past the last known remote input, before new remote inputs are known
+	 */
+	void saveSimulatedRemoteInputs(PlayerNumber remotePlayerNumber);
+	/**
+	 * @brief Get the saved remote input a frame was simulated with
+	 * @return std::nullopt if the input of the frame was not saved
+	 */
+	[[nodiscard]] std::optional<PlayerInput> getSimulatedRemoteInput(int frame) const;
+	/**
+	 * @brief Compare the remote inputs known now with the saved ones, only the keys relevant to the game data before each frame count
+	 * @return RELEVANT if a simulated frame changes, so a rollback is needed
+	 */
+	[[nodiscard]] SimulationChange getSimulationChange(PlayerNumber remotePlayerNumber) const;
+	/**
+	 * @brief Find the game data after a frame, confirmed or not
+	 * @return nullptr if the frame has no snapshot
+	 */
+	[[nodiscard]] const ClientGameData* findGameData(int frame) const;
+
+	/**
+	 * @brief The oldest unconfirmed game data becomes the confirmed one
+	 */
+	void confirmUnconfirmedGameData();
+	/**
+	 * @brief Move the input delay one frame toward the half of the confirmation latency
+	 * @return The change of the delay, -1, 0 or 1
+	 */
+	int updateInputDelay();
 };
\ No newline at end of file
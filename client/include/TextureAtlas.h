@@ -0,0 +1,85 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief All the images of a directory packed in one texture, to draw them without binding another texture <br>
+ * The packed image and its layout are cached next to each other and only rebuilt when an image is newer than the cache
+ */
+class TextureAtlas
+{
+ public:
+	TextureAtlas() = default;
+
+	/**
+	 * @brief Width of the packed image, the images go on shelves of this width
+	 */
+	static constexpr unsigned MAX_WIDTH = 512;
+	/**
+	 * @brief Transparent pixels between two images, so a sprite never samples its neighbour
+	 */
+	static constexpr unsigned PADDING = 1;
+
+ private:
+	sf::Texture _texture;
+	/**
+	 * @brief Rectangle of each image in the texture, by its path relative to the directory without the extension, like "player/idle_0"
+	 */
+	std::unordered_map<std::string, sf::IntRect> _textureRects;
+
+	/**
+	 * @brief Decode the PNGs and pack them in one image
+	 * @param directory Directory the names of the images are relative to
+	 * @param paths PNGs to pack
+	 * @param image Packed image
+	 * @return false if an image could not be decoded
+	 */
+	bool build(const std::filesystem::path& directory, const std::vector<std::filesystem::path>& paths, sf::Image& image);
+	bool loadCache(const std::filesystem::path& cachePath);
+	bool saveCache(const std::filesystem::path& cachePath, const sf::Image& image) const;
+
+ public:
+	/**
+	 * @brief Load the atlas of the directory from the cache, or build it from the PNGs and write the cache when it is missing or outdated
+	 * @param directory Directory of the PNGs, searched recursively
+	 * @param cachePath Path of the cache without extension, the image is written to cachePath.png and its layout to cachePath.txt
+	 * @return false if the atlas could not be loaded nor built
+	 */
+	bool Load(const std::filesystem::path& directory, const std::filesystem::path& cachePath);
+
+	[[nodiscard]] const sf::Texture& GetTexture() const { return _texture; }
+	/**
+	 * @brief Rectangle of an image in the texture, empty if there is no image with this name
+	 * @param name Path of the image relative to the directory without the extension, like "player/idle_0"
+	 */
+	[[nodiscard]] sf::IntRect GetTextureRect(const std::string& name) const;
+	[[nodiscard]] std::size_t GetImageCount() const { return _textureRects.size(); }
+
+	/**
+	 * @brief Place rectangles on shelves from the tallest to the shortest, with PADDING between them
+	 * @param sizes Size of each rectangle
+	 * @param maxWidth Width of a shelf, a rectangle wider than it gets its own shelf
+	 * @param atlasSize Size needed to hold all the rectangles
+	 * @return Rectangle of each size, in the same order
+	 */
+	static std::vector<sf::IntRect> Pack(const std::vector<sf::Vector2u>& sizes, unsigned maxWidth, sf::Vector2u& atlasSize);
+	/**
+	 * @brief Write the rectangle of each image, one image per line: left top width height name
+	 * @return false if the file could not be written
+	 */
+	static bool WriteLayout(const std::filesystem::path& path, const std::unordered_map<std::string, sf::IntRect>& textureRects);
+	/**
+	 * @brief Read the rectangles written by WriteLayout, the names can contain spaces
+	 * @return false if the file is missing or a line is malformed
+	 */
+	static bool ReadLayout(const std::filesystem::path& path, std::unordered_map<std::string, sf::IntRect>& textureRects);
+	/**
+	 * @brief Check if the cache exists and is newer than all the PNGs of the directory, without decoding them
+	 */
+	static bool IsCacheUpToDate(const std::filesystem::path& directory, const std::filesystem::path& cachePath);
+};
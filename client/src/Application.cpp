@@ -10,13 +10,31 @@
 #include "MyPackets/LeaveGamePacket.h"
 #include "MyPackets/LeaveLobbyPacket.h"
 
+#include "Profiler.h"
+#include "MemoryTracker.h"
+
 #include <SFML/Graphics.hpp>
+
+#include <algorithm>
 #include <utility>
 
 #ifdef TRACY_ENABLE
 #include <tracy/Tracy.hpp>
 #endif
 
+namespace
+{
+	/**
+	 * @brief Allocations of the game state, the network threads allocate at the same time so their memory is not counted
+	 */
+	std::uint64_t gameStateAllocations() noexcept
+	{
+		return MemoryTracker::GetStatistics(MemoryTag::Physics).Allocations
+			+ MemoryTracker::GetStatistics(MemoryTag::QuadTree).Allocations
+			+ MemoryTracker::GetStatistics(MemoryTag::Rollback).Allocations;
+	}
+}
+
 Application::Application(RollbackManager& rollbackManager, GameManager& gameManager, ClientNetworkInterface& clientNetworkInterface, ScreenSizeValue width, ScreenSizeValue height) :
 	_rollbackManager(rollbackManager), _gameManager(gameManager), _networkManager(clientNetworkInterface), _width(width), _height(height)
 {
@@ -34,9 +52,12 @@ void Application::AddLocalPlayerInput(PlayerInput playerInput)
 {
 	if (_state != GameState::GAME || _gameManager.GetGameData().IsGameOver()) return;
 
-	// Save the local player input for the current frame and send it to the server
+	// Save the local player input for the current frame and send it to the server, the inputs are sent again while waiting for confirmations
 	_rollbackManager.AddPlayerInputs(playerInput);
-	_networkManager.SendPacket(new MyPackets::PlayerInputPacket(_rollbackManager.GetLastLocalPlayerInputs()), Protocol::UDP);
+
+	const auto frameAdvantage = static_cast<sf::Int8>(std::clamp(_rollbackManager.GetLocalFrameAdvantage(), -128, 127));
+
+	_networkManager.SendPacket(new MyPackets::PlayerInputPacket(_rollbackManager.GetLastLocalPlayerInputs(), _rollbackManager.GetCurrentFrame(), frameAdvantage), Protocol::UDP);
 }
 
 void Application::FixedUpdate()
@@ -45,7 +66,9 @@ void Application::FixedUpdate()
 	ZoneScoped;
 #endif
 
-	sf::Time elapsed = sf::seconds(FIXED_TIME_STEP);
+	// Should stay at 0 once the rollback snapshots are big enough, the game data is only copied into existing buffers
+	static auto& allocationsHistogram = Profiler::GetHistogram("FixedUpdate::allocations", ProfileUnit::Count);
+	const auto allocationsBefore = gameStateAllocations();
 
 	// Process all packets received from the server since the last fixed update
 	while (Packet* packet = _networkManager.PopPacket())
@@ -74,45 +97,11 @@ void Application::FixedUpdate()
 
 	if (_state == GameState::GAME && _renderer != nullptr)
 	{
-		// Rollback if needed before updating the game
-		if (_rollbackManager.NeedToRollback())
-		{
-#ifdef TRACY_ENABLE
-			ZoneNamedN(rollbackZone, "Rollback", true);
-#endif
-			// The confirmed frame of the last set of confirmed game data
-			const auto oldConfirmedFrame = _rollbackManager.GetConfirmedFrame();
-			const auto confirmedInputFrame = _rollbackManager.GetConfirmedInputFrame();
-			const auto currentFrame = _rollbackManager.GetCurrentFrame();
-
-			_gameManager.SetGameData(_rollbackManager.GetConfirmedGameData());
-			_rollbackManager.ResetUnconfirmedGameData();
-
-			// Rollback before the current frame
-			for (auto frame = oldConfirmedFrame; frame < currentFrame; frame++)
-			{
-				UpdateGame(frame);
-				_gameManager.UpdatePlayerAnimations(elapsed, sf::seconds(0));
-
-				// Happens when rollback is happening by reception of a confirmed input without remote inputs
-				// So, it needs to update the confirmed game data when validating the confirmed input
-				if (frame < confirmedInputFrame)
-				{
-					_rollbackManager.SetConfirmedGameData(_gameManager.GetGameData());
-					_rollbackManager.CheckIntegrity(frame);
-				}
-				else
-				{
-					_rollbackManager.AddUnconfirmedGameData(_gameManager.GetGameData());
-				}
-			}
-
-			_rollbackManager.RollbackDone();
-		}
+		// Rollback if needed, then update the game with the current frame
+		_rollbackManager.SimulateFrames(_gameManager);
 
-		// Update the game with the current frame
-		UpdateGame(_rollbackManager.GetCurrentFrame());
-		_rollbackManager.AddUnconfirmedGameData(_gameManager.GetGameData());
+		// Drawn blended with the previous fixed update until the next one
+		_gameManager.SaveRenderTransforms();
 
 		// Check if the game is over
 		if (_gameManager.GetGameData().BricksLeft == 0)
@@ -120,6 +109,8 @@ void Application::FixedUpdate()
 			_renderer->OnEvent(_gameManager.GetLocalPlayerRole() == PlayerRole::PLAYER ? Event::WIN_GAME : Event::LOSE_GAME);
 		}
 	}
+
+	allocationsHistogram.AddSample(gameStateAllocations() - allocationsBefore);
 }
 
 void Application::Update(sf::Time elapsed, sf::Time elapsedSinceLastFixed, sf::Vector2f mousePosition)
@@ -152,7 +143,9 @@ void Application::SetState(GameState state)
 	{
 		case GameState::MAIN_MENU: _renderer = new MenuRenderer(*this, _width, _height); break;
 		case GameState::LOBBY: _renderer = new LobbyRenderer(*this, _width, _height); break;
-		case GameState::GAME: _renderer = new GameRenderer(*this, _gameManager, _width, _height); break;
+		case GameState::GAME:
+			_renderer = new GameRenderer(*this, _gameManager, _width, _height);
+			break;
 		default: break;
 	}
 
@@ -209,18 +202,14 @@ void Application::OnPacketReceived(Packet& packet)
 	}
 }
 
-void Application::Quit()
+float Application::GetFixedTimeStep() const
 {
-	_running = false;
+	if (_state != GameState::GAME) return FIXED_TIME_STEP;
+
+	return _rollbackManager.GetFixedTimeStep();
 }
 
-void Application::UpdateGame(int frame)
+void Application::Quit()
 {
-	const auto previousFrame = frame - 1;
-	const auto currentPlayer1Inputs = _rollbackManager.GetPlayerInput(PlayerNumber::PLAYER1, frame);
-	const auto previousPlayer1Inputs = _rollbackManager.GetPlayerInput(PlayerNumber::PLAYER1, previousFrame);
-	const auto currentPlayer2Inputs = _rollbackManager.GetPlayerInput(PlayerNumber::PLAYER2, frame);
-	const auto previousPlayer2Inputs = _rollbackManager.GetPlayerInput(PlayerNumber::PLAYER2, previousFrame);
-
-	_gameManager.FixedUpdate(currentPlayer1Inputs, previousPlayer1Inputs, currentPlayer2Inputs, previousPlayer2Inputs);
+	_running = false;
 }
\ No newline at end of file
@@ -1,14 +1,32 @@
 #include "AssetManager.h"
 
+#include "TextureAtlas.h"
+
+#include <algorithm>
 #include <array>
 
 namespace AssetManager
 {
+	/**
+	 * @brief Name of the frames of an animation in the atlas, followed by the frame number
+	 */
+	struct AnimationFrames
+	{
+		const char* Name;
+		int Count;
+	};
+
+	static constexpr std::array<AnimationFrames, static_cast<std::size_t>(AtlasAnimation::COUNT)> ANIMATION_FRAMES = {{
+		{ "player/idle_", PLAYER_IDLE_FRAMES },
+		{ "player/walk_", PLAYER_WALK_FRAMES },
+		{ "player/jump_", PLAYER_JUMP_FRAMES },
+		{ "ghost/idle_", GHOST_IDLE_FRAMES }
+	}};
+	static constexpr int MAX_ANIMATION_FRAMES = std::max({ PLAYER_IDLE_FRAMES, PLAYER_WALK_FRAMES, PLAYER_JUMP_FRAMES, GHOST_IDLE_FRAMES });
+
 	static sf::Font mainFont;
-	static std::array<sf::Texture, PLAYER_IDLE_FRAMES> playerIdleTextures;
-	static std::array<sf::Texture, PLAYER_WALK_FRAMES> playerWalkTextures;
-	static std::array<sf::Texture, PLAYER_JUMP_FRAMES> playerJumpTextures;
-	static std::array<sf::Texture, GHOST_IDLE_FRAMES> ghostIdleTextures;
+	static TextureAtlas atlas;
+	static std::array<std::array<sf::IntRect, MAX_ANIMATION_FRAMES>, static_cast<std::size_t>(AtlasAnimation::COUNT)> animationRects;
 
 	static bool initialized = false;
 
@@ -16,24 +34,15 @@ namespace AssetManager
 	{
 		initialized = true;
 
-		for (auto i = 0; i < PLAYER_IDLE_FRAMES; i++)
-		{
-			playerIdleTextures[i].loadFromFile("data/textures/player/idle_" + std::to_string(i) + ".png");
-		}
-
-		for (auto i = 0; i < PLAYER_WALK_FRAMES; i++)
-		{
-			playerWalkTextures[i].loadFromFile("data/textures/player/walk_" + std::to_string(i) + ".png");
-		}
+		atlas.Load("data/textures", "data/cache/atlas");
 
-		for (auto i = 0; i < PLAYER_JUMP_FRAMES; i++)
+		// Looked up once by name, then by index when drawing
+		for (std::size_t animation = 0; animation < ANIMATION_FRAMES.size(); animation++)
 		{
-			playerJumpTextures[i].loadFromFile("data/textures/player/jump_" + std::to_string(i) + ".png");
-		}
-
-		for (auto i = 0; i < GHOST_IDLE_FRAMES; i++)
-		{
-			ghostIdleTextures[i].loadFromFile("data/textures/ghost/idle_" + std::to_string(i) + ".png");
+			for (auto frame = 0; frame < ANIMATION_FRAMES[animation].Count; frame++)
+			{
+				animationRects[animation][frame] = atlas.GetTextureRect(ANIMATION_FRAMES[animation].Name + std::to_string(frame));
+			}
 		}
 
 		mainFont.loadFromFile("data/font/Retro Gaming.ttf");
@@ -44,32 +53,18 @@ namespace AssetManager
 		return mainFont;
 	}
 
-	sf::Texture& GetPlayerIdleTexture(int frame)
+	const sf::Texture& GetAtlasTexture()
 	{
-		if (frame >= PLAYER_IDLE_FRAMES) frame %= PLAYER_IDLE_FRAMES;
-
-		return playerIdleTextures[frame];
+		return atlas.GetTexture();
 	}
 
-	sf::Texture& GetPlayerWalkTexture(int frame)
+	const sf::IntRect& GetTextureRect(AtlasAnimation animation, int frame)
 	{
-		if (frame >= PLAYER_WALK_FRAMES) frame %= PLAYER_WALK_FRAMES;
+		const auto index = static_cast<std::size_t>(animation);
 
-		return playerWalkTextures[frame];
-	}
-
-	sf::Texture& GetPlayerJumpTexture(int frame)
-	{
-		if (frame >= PLAYER_JUMP_FRAMES) frame %= PLAYER_JUMP_FRAMES;
-
-		return playerJumpTextures[frame];
-	}
-
-	sf::Texture& GetGhostIdleTexture(int frame)
-	{
-		if (frame >= GHOST_IDLE_FRAMES) frame %= GHOST_IDLE_FRAMES;
+		if (frame >= ANIMATION_FRAMES[index].Count) frame %= ANIMATION_FRAMES[index].Count;
 
-		return ghostIdleTextures[frame];
+		return animationRects[index][frame];
 	}
 
 	bool IsInitialized()
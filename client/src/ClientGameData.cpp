@@ -9,22 +9,8 @@ void ClientGameData::SetLocalPlayerRole(PlayerRole playerRole, bool isFirstPlaye
 	IsFirstPlayer = isFirstPlayer;
 }
 
-void ClientGameData::UpdatePlayersAnimations(sf::Time elapsed, sf::Time elapsedSinceLastFixed)
+void ClientGameData::UpdatePlayersAnimations(sf::Time elapsed, const std::array<Math::Vec2F, MAX_PLAYERS>& playerPositions)
 {
-	const auto& body = World.GetBody(PlayerBody);
-	auto playerForces = GetNextPlayerForces();
-	auto playerForce = playerForces.Force;
-	auto playerVelocity = playerForces.Velocity;
-	auto playerPosition = World.GetBody(PlayerBody).Position();
-
-	playerForce += GRAVITY;
-
-	playerVelocity += playerForce * body.InverseMass() * elapsedSinceLastFixed.asSeconds();
-	playerPosition += playerVelocity * elapsedSinceLastFixed.asSeconds();
-
-	const std::array<Math::Vec2F, MAX_PLAYERS> playerPositions = {
-		playerPosition, GetGhostPosition()
-	};
 	const std::array<PlayerInput, MAX_PLAYERS> playerInputs = {
 		_playerInputs, _ghostInputs
 	};
@@ -106,4 +92,9 @@ void ClientGameData::OnSwitchPlayerAndGhost()
 
 	Players[0].SetPlayerRole(PlayerRole::PLAYER, LocalPlayerRole == PlayerRole::PLAYER);
 	Players[1].SetPlayerRole(PlayerRole::GHOST, LocalPlayerRole == PlayerRole::GHOST);
+}
+
+PlayerInput ClientGameData::GetRemoteRelevantInputs(bool asPreviousInput) const
+{
+	return GetRelevantInputs(LocalPlayerRole == PlayerRole::PLAYER ? PlayerRole::GHOST : PlayerRole::PLAYER, asPreviousInput);
 }
\ No newline at end of file
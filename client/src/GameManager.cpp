@@ -13,6 +13,7 @@ void GameManager::OnPacketReceived(Packet& packet)
 
 		_gameData.SetLocalPlayerRole(startGamePacket.IsPlayer ? PlayerRole::PLAYER : PlayerRole::GHOST, startGamePacket.IsFirstNumber);
 		_gameData.StartGame(_width, _height);
+		_renderInterpolation.Reset();
 	}
 }
 
@@ -27,18 +28,36 @@ void GameManager::FixedUpdate(PlayerInput player1Input, PlayerInput player1Previ
 	_gameData.FixedUpdate();
 }
 
-ClientGameData GameManager::GetGameData() const
+const ClientGameData& GameManager::GetGameData() const
 {
 	return _gameData;
 }
 
-void GameManager::SetGameData(ClientGameData gameData)
+void GameManager::SetGameData(const ClientGameData& gameData)
 {
-	_gameData = std::move(gameData);
+	_gameData = gameData;
 	_gameData.World.SetContactListener(&_gameData);
 }
 
+void GameManager::SimulateFrame(FinalInputs inputs, FinalInputs previousInputs, bool isRollback)
+{
+	FixedUpdate(inputs.Player1Input, previousInputs.Player1Input, inputs.Player2Input, previousInputs.Player2Input);
+
+	if (isRollback) UpdatePlayerAnimations(sf::seconds(FIXED_TIME_STEP), sf::Time::Zero);
+}
+
 void GameManager::UpdatePlayerAnimations(sf::Time elapsed, sf::Time elapsedSinceLastFixed)
 {
-	_gameData.UpdatePlayersAnimations(elapsed, elapsedSinceLastFixed);
+	const auto alpha = RenderInterpolation::GetAlpha(elapsedSinceLastFixed);
+	const std::array<Math::Vec2F, MAX_PLAYERS> playerPositions = {
+		_renderInterpolation.GetPlayerPosition(0, alpha),
+		_renderInterpolation.GetPlayerPosition(1, alpha)
+	};
+
+	_gameData.UpdatePlayersAnimations(elapsed, playerPositions);
+}
+
+void GameManager::SaveRenderTransforms()
+{
+	_renderInterpolation.Push(_gameData);
 }
\ No newline at end of file
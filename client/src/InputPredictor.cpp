@@ -0,0 +1,72 @@
+#include "InputPredictor.h"
+
+#include <algorithm>
+#include <array>
+
+PlayerInput RepeatLastInputPredictor::Predict(std::span<const PlayerInput> history, int) const
+{
+	return history.back();
+}
+
+ReleaseEdgesInputPredictor::ReleaseEdgesInputPredictor(PlayerInput edgeKeys, int tapFrames) : _edgeKeys(edgeKeys), _tapFrames(tapFrames) {}
+
+PlayerInput ReleaseEdgesInputPredictor::Predict(std::span<const PlayerInput> history, int framesAhead) const
+{
+	auto predictedInput = history.back();
+
+	for (PlayerInput key = 1; key != 0; key <<= 1)
+	{
+		if ((predictedInput & key & _edgeKeys) == 0) continue;
+
+		int heldFrames = 0;
+
+		for (auto it = history.rbegin(); it != history.rend() && (*it & key) != 0; ++it)
+		{
+			heldFrames++;
+		}
+
+		// A key held longer than a tap is held on purpose
+		if (heldFrames > _tapFrames) continue;
+
+		if (heldFrames + framesAhead > _tapFrames)
+		{
+			predictedInput &= static_cast<PlayerInput>(~key);
+		}
+	}
+
+	return predictedInput;
+}
+
+PatternInputPredictor::PatternInputPredictor(int patternLength) : _patternLength(std::max(patternLength, 1)) {}
+
+PlayerInput PatternInputPredictor::Predict(std::span<const PlayerInput> history, int framesAhead) const
+{
+	// The predicted inputs are added after the history, to predict the next ones from them
+	std::array<PlayerInput, INPUT_PREDICTION_HISTORY + MAX_PREDICTED_FRAMES> inputs {};
+	const auto historySize = std::min(history.size(), INPUT_PREDICTION_HISTORY);
+	std::copy(history.end() - static_cast<std::ptrdiff_t>(historySize), history.end(), inputs.begin());
+
+	const auto patternLength = static_cast<std::size_t>(_patternLength);
+	const auto steps = static_cast<std::size_t>(std::clamp(framesAhead, 1, MAX_PREDICTED_FRAMES));
+	auto size = historySize;
+
+	for (std::size_t step = 0; step < steps; step++)
+	{
+		auto nextInput = inputs[size - 1];
+
+		// From the most recent occurrence of the pattern, which ends before the last input
+		for (auto end = size - 1; end-- >= patternLength;)
+		{
+			if (std::equal(inputs.begin() + static_cast<std::ptrdiff_t>(end + 1 - patternLength), inputs.begin() + static_cast<std::ptrdiff_t>(end + 1),
+				inputs.begin() + static_cast<std::ptrdiff_t>(size - patternLength)))
+			{
+				nextInput = inputs[end + 1];
+				break;
+			}
+		}
+
+		inputs[size++] = nextInput;
+	}
+
+	return inputs[size - 1];
+}
@@ -3,55 +3,33 @@
 #include "Constants.h"
 #include "AssetManager.h"
 
-void PlayerDrawable::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void PlayerDrawable::AddTo(SpriteBatch& spriteBatch) const
 {
-	// Draw the player sprite
-	sf::Sprite sprite;
-
-	if (_role == PlayerRole::PLAYER)
-	{
-		sprite.setTextureRect(sf::IntRect(0, 0, PLAYER_SIZE.X, PLAYER_SIZE.Y));
-		sprite.setOrigin(PLAYER_SIZE.X / 2.0f, PLAYER_SIZE.Y / 2.0f);
-	}
-	else
-	{
-		sprite.setTextureRect(sf::IntRect(0, 0, GHOST_SIZE.X, GHOST_SIZE.Y));
-		sprite.setOrigin(GHOST_SIZE.X / 2.0f, GHOST_SIZE.Y / 2.0f);
-	}
-
-	sprite.setPosition(_position);
-	sprite.setColor(_color);
+	auto animation = AtlasAnimation::PLAYER_IDLE;
 
 	switch (_animation)
 	{
 	case PlayerAnimation::IDLE:
-		if (_role == PlayerRole::PLAYER)
-		{
-			sprite.setTexture(AssetManager::GetPlayerIdleTexture(_frame));
-		}
-		else
-		{
-			sprite.setTexture(AssetManager::GetGhostIdleTexture(_frame));
-		}
+		animation = _role == PlayerRole::PLAYER ? AtlasAnimation::PLAYER_IDLE : AtlasAnimation::GHOST_IDLE;
 		break;
 	case PlayerAnimation::WALK:
-		sprite.setTexture(AssetManager::GetPlayerWalkTexture(_frame));
+		animation = AtlasAnimation::PLAYER_WALK;
 		break;
 	case PlayerAnimation::JUMP:
-		sprite.setTexture(AssetManager::GetPlayerJumpTexture(_frame));
+		animation = AtlasAnimation::PLAYER_JUMP;
 		break;
 	}
 
-	if (_direction == PlayerDirection::LEFT)
-	{
-		sprite.setScale(-PLAYER_SIZE_SCALE, PLAYER_SIZE_SCALE);
-	}
-	else
-	{
-		sprite.setScale(PLAYER_SIZE_SCALE, PLAYER_SIZE_SCALE);
-	}
+	const auto size = _role == PlayerRole::PLAYER ? PLAYER_SIZE : GHOST_SIZE;
+	const auto scaleX = _direction == PlayerDirection::LEFT ? -PLAYER_SIZE_SCALE : PLAYER_SIZE_SCALE;
 
-	target.draw(sprite, states);
+	spriteBatch.Add(
+		AssetManager::GetTextureRect(animation, _frame),
+		_position,
+		sf::Vector2f(size.X / 2.0f, size.Y / 2.0f),
+		sf::Vector2f(scaleX, PLAYER_SIZE_SCALE),
+		_color
+	);
 }
 
 void PlayerDrawable::Update(sf::Time elapsed)
@@ -0,0 +1,66 @@
+#include "RenderInterpolation.h"
+
+#include <algorithm>
+
+Math::Vec2F RenderInterpolation::blend(Math::Vec2F previousPosition, Math::Vec2F currentPosition, float alpha)
+{
+	if ((currentPosition - previousPosition).Length() > SNAP_DISTANCE) return currentPosition;
+
+	return Math::Vec2F::Lerp(previousPosition, currentPosition, alpha);
+}
+
+void RenderInterpolation::Push(const GameData& gameData)
+{
+	_current = 1 - _current;
+
+	auto& transforms = _transforms[_current];
+
+	transforms.PlayerPositions[0] = gameData.World.GetBody(gameData.PlayerBody).Position();
+	transforms.PlayerPositions[1] = gameData.GetGhostPosition();
+
+	for (auto handIndex = 0; handIndex < HAND_SLOT_COUNT; handIndex++)
+	{
+		for (auto brickIndex = 0; brickIndex < MAX_BRICKS_PER_COLUMN; brickIndex++)
+		{
+			const auto& brick = gameData.BricksPerSlot[handIndex][brickIndex];
+
+			transforms.IsBrickAlive[handIndex][brickIndex] = brick.IsAlive;
+
+			if (!brick.IsAlive) continue;
+
+			transforms.BrickPositions[handIndex][brickIndex] = gameData.World.GetCollider(brick.Collider).GetPosition();
+		}
+	}
+
+	// Nothing to blend with, the first fixed update is drawn as is
+	if (!_hasTransforms)
+	{
+		_transforms[1 - _current] = transforms;
+		_hasTransforms = true;
+	}
+}
+
+void RenderInterpolation::Reset()
+{
+	_hasTransforms = false;
+}
+
+Math::Vec2F RenderInterpolation::GetPlayerPosition(std::size_t playerIndex, float alpha) const
+{
+	return blend(previous().PlayerPositions[playerIndex], current().PlayerPositions[playerIndex], alpha);
+}
+
+Math::Vec2F RenderInterpolation::GetBrickPosition(int handIndex, int brickIndex, float alpha) const
+{
+	const auto& currentPosition = current().BrickPositions[handIndex][brickIndex];
+
+	// A brick spawned at the last fixed update, or one that reuses the slot of a dead brick, has nothing to blend with
+	if (!previous().IsBrickAlive[handIndex][brickIndex]) return currentPosition;
+
+	return blend(previous().BrickPositions[handIndex][brickIndex], currentPosition, alpha);
+}
+
+float RenderInterpolation::GetAlpha(sf::Time elapsedSinceLastFixed)
+{
+	return std::clamp(elapsedSinceLastFixed.asSeconds() / FIXED_TIME_STEP, 0.f, 1.f);
+}
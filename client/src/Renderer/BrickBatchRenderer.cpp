@@ -0,0 +1,93 @@
+#include "Renderer/BrickBatchRenderer.h"
+
+namespace
+{
+	/**
+	 * @brief Write the two triangles of a quad
+	 */
+	void writeQuad(sf::Vertex* vertices, sf::Vector2f min, sf::Vector2f max, sf::Color color)
+	{
+		const sf::Vector2f topRight(max.x, min.y);
+		const sf::Vector2f bottomLeft(min.x, max.y);
+
+		vertices[0] = sf::Vertex(min, color);
+		vertices[1] = sf::Vertex(topRight, color);
+		vertices[2] = sf::Vertex(bottomLeft, color);
+		vertices[3] = sf::Vertex(topRight, color);
+		vertices[4] = sf::Vertex(max, color);
+		vertices[5] = sf::Vertex(bottomLeft, color);
+	}
+}
+
+BrickBatchRenderer::BrickBatchRenderer() : _vertices(sf::Triangles, (BRICK_COUNT + 1) * VERTICES_PER_RECTANGLE)
+{
+	for (std::size_t i = 0; i < BRICK_COUNT + 1; i++)
+	{
+		ClearRectangle(&_vertices[i * VERTICES_PER_RECTANGLE]);
+	}
+}
+
+void BrickBatchRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	target.draw(_vertices, states);
+}
+
+void BrickBatchRenderer::SetPlatform(sf::Vector2f center, sf::Vector2f size)
+{
+	WriteRectangle(&_vertices[0], center, size, PLATFORM_OUTLINE_THICKNESS, sf::Color::White, sf::Color::Black);
+}
+
+void BrickBatchRenderer::Update(const GameData& gameData, const RenderInterpolation& renderInterpolation, float alpha)
+{
+	_lastUpdatedBrickCount = 0;
+
+	for (auto handIndex = 0; handIndex < HAND_SLOT_COUNT; handIndex++)
+	{
+		for (auto brickIndex = 0; brickIndex < MAX_BRICKS_PER_COLUMN; brickIndex++)
+		{
+			const auto& brick = gameData.BricksPerSlot[handIndex][brickIndex];
+			const auto index = static_cast<std::size_t>(handIndex * MAX_BRICKS_PER_COLUMN + brickIndex);
+			auto& state = _brickStates[index];
+			auto* vertices = &_vertices[(index + 1) * VERTICES_PER_RECTANGLE];
+
+			if (!brick.IsAlive)
+			{
+				if (!state.IsAlive) continue;
+
+				state.IsAlive = false;
+				ClearRectangle(vertices);
+				_lastUpdatedBrickCount++;
+
+				continue;
+			}
+
+			const auto position = renderInterpolation.GetBrickPosition(handIndex, brickIndex, alpha);
+			const auto size = gameData.World.GetCollider(brick.Collider).GetRectangle().Size();
+
+			if (state.IsAlive && state.Position == position && state.Size == size) continue;
+
+			state = { true, position, size };
+			WriteRectangle(vertices, { position.X, position.Y }, { size.X, size.Y }, BRICK_OUTLINE_THICKNESS, sf::Color::White, sf::Color::Black);
+			_lastUpdatedBrickCount++;
+		}
+	}
+}
+
+void BrickBatchRenderer::WriteRectangle(sf::Vertex* vertices, sf::Vector2f center, sf::Vector2f size, float outlineThickness,
+	sf::Color fillColor, sf::Color outlineColor)
+{
+	const auto min = center - size / 2.f;
+	const auto max = center + size / 2.f;
+	const sf::Vector2f thickness(outlineThickness, outlineThickness);
+
+	writeQuad(vertices, min, max, outlineColor);
+	writeQuad(vertices + VERTICES_PER_RECTANGLE / 2, min + thickness, max - thickness, fillColor);
+}
+
+void BrickBatchRenderer::ClearRectangle(sf::Vertex* vertices)
+{
+	for (std::size_t i = 0; i < VERTICES_PER_RECTANGLE; i++)
+	{
+		vertices[i] = sf::Vertex(sf::Vector2f(0.f, 0.f), sf::Color::Transparent);
+	}
+}
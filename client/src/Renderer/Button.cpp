@@ -78,6 +78,11 @@ void Button::SetText(const std::vector<TextLine>& texts)
 	_text = Text(position, texts, _background.getSize().x, _centered);
 }
 
+void Button::AddTextTo(GlyphBatch& glyphBatch) const
+{
+	_text.AddTo(glyphBatch);
+}
+
 sf::FloatRect Button::GetGlobalBounds() const
 {
 	return _background.getGlobalBounds();
@@ -96,7 +101,6 @@ void Button::SetOnClick(const std::function<void()>& onClick)
 void Button::draw(sf::RenderTarget& target, const sf::RenderStates states) const
 {
 	target.draw(_background, states);
-	target.draw(_text, states);
 }
 
 void Button::Update(const sf::Time elapsed)
@@ -0,0 +1,103 @@
+#include "Renderer/GlyphBatch.h"
+
+#include "AssetManager.h"
+
+sf::VertexArray& GlyphBatch::page(unsigned characterSize)
+{
+	// Only a few sizes are used, a linear search is enough
+	for (auto& page : _pages)
+	{
+		if (page.CharacterSize == characterSize) return page.Vertices;
+	}
+
+	return _pages.emplace_back(Page{ characterSize, sf::VertexArray(sf::Triangles) }).Vertices;
+}
+
+void GlyphBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	if (!AssetManager::IsInitialized()) return;
+
+	const auto& font = AssetManager::GetMainFont();
+
+	for (const auto& page : _pages)
+	{
+		if (page.Vertices.getVertexCount() == 0) continue;
+
+		states.texture = &font.getTexture(page.CharacterSize);
+		target.draw(page.Vertices, states);
+	}
+}
+
+void GlyphBatch::Clear()
+{
+	for (auto& page : _pages)
+	{
+		page.Vertices.clear();
+	}
+}
+
+void GlyphBatch::Add(const TextLayout& layout, sf::Vector2f offset, sf::Color color)
+{
+	if (layout.Vertices.empty()) return;
+
+	auto& vertices = page(layout.CharacterSize);
+
+	for (auto vertex : layout.Vertices)
+	{
+		vertex.position += offset;
+		vertex.color = color;
+		vertices.append(vertex);
+	}
+}
+
+void GlyphBatch::Add(const GlyphBatch& other)
+{
+	for (const auto& otherPage : other._pages)
+	{
+		const auto vertexCount = otherPage.Vertices.getVertexCount();
+
+		if (vertexCount == 0) continue;
+
+		auto& vertices = page(otherPage.CharacterSize);
+
+		for (std::size_t i = 0; i < vertexCount; i++)
+		{
+			vertices.append(otherPage.Vertices[i]);
+		}
+	}
+}
+
+void GlyphBatch::SetColor(sf::Color color)
+{
+	for (auto& page : _pages)
+	{
+		for (std::size_t i = 0; i < page.Vertices.getVertexCount(); i++)
+		{
+			page.Vertices[i].color = color;
+		}
+	}
+}
+
+std::size_t GlyphBatch::GetDrawCallCount() const
+{
+	std::size_t drawCalls = 0;
+
+	for (const auto& page : _pages)
+	{
+		if (page.Vertices.getVertexCount() > 0) drawCalls++;
+	}
+
+	return drawCalls;
+}
+
+std::size_t GlyphBatch::GetVertexCount() const
+{
+	std::size_t vertexCount = 0;
+
+	for (const auto& page : _pages)
+	{
+		vertexCount += page.Vertices.getVertexCount();
+	}
+
+	return vertexCount;
+}
@@ -14,10 +14,7 @@ void Renderer::draw(sf::RenderTarget& target, const sf::RenderStates states) con
 		}
 	}
 
-	for (auto& text : _texts)
-	{
-		target.draw(text, states);
-	}
+	target.draw(_glyphBatch, states);
 }
 
 void Renderer::Update(const sf::Time elapsed, sf::Time elapsedSinceLastFixed, sf::Vector2f mousePosition)
@@ -50,6 +47,22 @@ void Renderer::Update(const sf::Time elapsed, sf::Time elapsedSinceLastFixed, sf
 
 	// Call the derived class's update method
 	OnUpdate(elapsed, elapsedSinceLastFixed, mousePosition);
+
+	// Batch the texts once they are updated, only the vertices are copied
+	_glyphBatch.Clear();
+
+	for (auto& button : _buttons)
+	{
+		if (!button.IsDisabled())
+		{
+			button.AddTextTo(_glyphBatch);
+		}
+	}
+
+	for (auto& text : _texts)
+	{
+		text.AddTo(_glyphBatch);
+	}
 }
 
 void Renderer::Input(sf::Event event)
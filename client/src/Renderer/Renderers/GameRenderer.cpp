@@ -1,10 +1,12 @@
 #include "Renderer/Renderers/GameRenderer.h"
 
 #include "Application.h"
+#include "AssetManager.h"
 #include "GameManager.h"
 
 GameRenderer::GameRenderer(Application& application, GameManager& gameManager, ScreenSizeValue width, ScreenSizeValue height) :
-	_application(application), _gameManager(gameManager), _height(height), _width(width)
+	_application(application), _gameManager(gameManager), _height(height), _width(width),
+	_spriteBatch(&AssetManager::GetAtlasTexture())
 {
 	// Set the texts to display at the start of the game on each lines
 	std::array<std::string_view, LINES_COUNT> lines = _gameManager.GetLocalPlayerRole() == PlayerRole::PLAYER ? START_PLAYER_MESSAGE : START_GHOST_MESSAGE;
@@ -29,82 +31,26 @@ GameRenderer::GameRenderer(Application& application, GameManager& gameManager, S
 			}})
 		}
 	));
+	// Freeze countdown, empty until the players are frozen
+	_texts.emplace_back();
 
 	_messageTimer = MESSAGE_TIMER;
+
+	_brickBatch.SetPlatform(
+		sf::Vector2f(PLATFORM_POSITION.X * _width, PLATFORM_POSITION.Y * _height),
+		sf::Vector2f(PLATFORM_SIZE.X * _width, PLATFORM_SIZE.Y * _height)
+	);
 }
 
 void GameRenderer::OnDraw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	ClientGameData gameData = _gameManager.GetGameData();
-
-	// Draw platform
-	static sf::RectangleShape platform;
-	platform.setSize(sf::Vector2f(PLATFORM_SIZE.X * _width, PLATFORM_SIZE.Y * _height));
-	platform.setFillColor(sf::Color::White);
-	platform.setOutlineColor(sf::Color::Black);
-	platform.setOutlineThickness(-2.f);
-	platform.setPosition(sf::Vector2f(PLATFORM_POSITION.X * _width, PLATFORM_POSITION.Y * _height));
-	platform.setOrigin(platform.getSize().x / 2.f, platform.getSize().y / 2.f);
-
-	target.draw(platform, states);
+	const auto& gameData = _gameManager.GetGameData();
 
 	// Draw players
-	for (auto& player : gameData.Players)
-	{
-		target.draw(player, states);
-	}
-
-	// Draw bricks
-	for (auto handIndex = 0; handIndex < HAND_SLOT_COUNT; handIndex++)
-	{
-		for (const auto& brick: gameData.BricksPerSlot[handIndex])
-		{
-			if (!brick.IsAlive) continue;
-
-			sf::RectangleShape brickShape;
-			auto brickCollider = gameData.World.GetCollider(brick.Collider);
-			auto brickPosition = brickCollider.GetPosition();
-			auto brickSize = brickCollider.GetRectangle().Size();
-
-			brickShape.setSize({brickSize.X, brickSize.Y});
-			brickShape.setFillColor(sf::Color::White);
-			brickShape.setOutlineColor(sf::Color::Black);
-			brickShape.setOutlineThickness(-1.f);
-			brickShape.setOrigin(
-				brickSize.X / 2.f,
-				brickSize.Y / 2.f
-			);
-			brickShape.setPosition(brickPosition.X, brickPosition.Y);
-
-			target.draw(brickShape, states);
-		}
-	}
+	target.draw(_spriteBatch, states);
 
-	if (gameData.FreezePlayersForFrames > 0)
-	{
-		const auto freezeTime = gameData.FreezePlayersForFrames / (PHYSICAL_FRAME_RATE / 10);
-		const auto seconds = freezeTime / 10;
-		const auto milliseconds = freezeTime % 10;
-
-		// Draw text to indicate that players are frozen for x seconds
-		auto text = Text(
-			sf::Vector2f(_width.Value / 2.f, _height.Value / 2.f),
-			{
-				TextLine({ CustomText{
-					.Text = "Players are frozen for",
-					.Color = sf::Color::Red,
-					.Size = 30,
-				}}),
-				TextLine({ CustomText{
-					.Text = std::to_string(seconds) + "." + std::to_string(milliseconds) + " seconds",
-					.Color = sf::Color::Red,
-					.Size = 30,
-				}})
-			}
-		);
-
-		target.draw(text, states);
-	}
+	// Draw the platform and the bricks over the players
+	target.draw(_brickBatch, states);
 
 	if (!gameData.IsGameOver()) return;
 
@@ -125,6 +71,45 @@ void GameRenderer::OnInput(sf::Event event)
 void GameRenderer::OnUpdate(sf::Time elapsed, sf::Time elapsedSinceLastFixed, sf::Vector2f mousePosition)
 {
 	_gameManager.UpdatePlayerAnimations(elapsed, elapsedSinceLastFixed);
+	_brickBatch.Update(_gameManager.GetGameData(), _gameManager.GetRenderInterpolation(), RenderInterpolation::GetAlpha(elapsedSinceLastFixed));
+
+	const auto freezePlayersForFrames = _gameManager.GetGameData().FreezePlayersForFrames;
+	const auto freezeTime = freezePlayersForFrames > 0 ? freezePlayersForFrames / (PHYSICAL_FRAME_RATE / 10) : -1;
+
+	if (freezeTime != _shownFreezeTime)
+	{
+		_shownFreezeTime = freezeTime;
+		_texts[FREEZE_TEXT_INDEX] = Text();
+
+		if (freezeTime >= 0)
+		{
+			const auto seconds = freezeTime / 10;
+			const auto milliseconds = freezeTime % 10;
+
+			// Text to indicate that players are frozen for x seconds
+			_texts[FREEZE_TEXT_INDEX] = Text(
+				sf::Vector2f(_width.Value / 2.f, _height.Value / 2.f),
+				{
+					TextLine({ CustomText{
+						.Text = "Players are frozen for",
+						.Color = sf::Color::Red,
+						.Size = 30,
+					}}),
+					TextLine({ CustomText{
+						.Text = std::to_string(seconds) + "." + std::to_string(milliseconds) + " seconds",
+						.Color = sf::Color::Red,
+						.Size = 30,
+					}})
+				}
+			);
+		}
+	}
+	_spriteBatch.Clear();
+
+	for (const auto& player : _gameManager.GetGameData().Players)
+	{
+		player.AddTo(_spriteBatch);
+	}
 
 	if (_messageTimer == 0.f) return;
 
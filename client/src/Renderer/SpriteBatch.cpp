@@ -0,0 +1,42 @@
+#include "Renderer/SpriteBatch.h"
+
+SpriteBatch::SpriteBatch(const sf::Texture* texture) : _texture(texture), _vertices(sf::Triangles)
+{
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	if (_vertices.getVertexCount() == 0) return;
+
+	states.texture = _texture;
+	target.draw(_vertices, states);
+}
+
+void SpriteBatch::Clear()
+{
+	_vertices.clear();
+}
+
+void SpriteBatch::Add(const sf::IntRect& textureRect, sf::Vector2f position, sf::Vector2f origin, sf::Vector2f scale, sf::Color color)
+{
+	const auto left = static_cast<float>(textureRect.left);
+	const auto top = static_cast<float>(textureRect.top);
+	const auto width = static_cast<float>(textureRect.width);
+	const auto height = static_cast<float>(textureRect.height);
+
+	const auto transform = [&](float x, float y) {
+		return sf::Vector2f(position.x + (x - origin.x) * scale.x, position.y + (y - origin.y) * scale.y);
+	};
+
+	const sf::Vertex topLeft(transform(0.f, 0.f), color, sf::Vector2f(left, top));
+	const sf::Vertex topRight(transform(width, 0.f), color, sf::Vector2f(left + width, top));
+	const sf::Vertex bottomLeft(transform(0.f, height), color, sf::Vector2f(left, top + height));
+	const sf::Vertex bottomRight(transform(width, height), color, sf::Vector2f(left + width, top + height));
+
+	_vertices.append(topLeft);
+	_vertices.append(topRight);
+	_vertices.append(bottomLeft);
+	_vertices.append(topRight);
+	_vertices.append(bottomRight);
+	_vertices.append(bottomLeft);
+}
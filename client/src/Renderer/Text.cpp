@@ -1,62 +1,43 @@
 #include "Renderer/Text.h"
 
-#include "AssetManager.h"
-
-sf::Text CustomText::ToSfText() const
-{
-	sf::Text text;
-	text.setString(Text);
-	text.setFillColor(Color);
-	text.setStyle(Style);
-	text.setCharacterSize(Size);
-
-	if (!AssetManager::IsInitialized()) return text;
-
-	text.setFont(AssetManager::GetMainFont());
-
-	return text;
-}
-
 Text::Text(sf::Vector2f position, const std::vector<TextLine>& texts, float maxX, const bool centered)
 {
 	_centered = centered;
 
 	for (auto& line : texts)
 	{
-		sf::Text text;
 		float maxHeight = 0.f;
 		const float baseX = position.x;
 
 		for (auto& customText : line.Texts)
 		{
-			text = customText.ToSfText();
-			text.setPosition(position);
+			const auto& layout = TextLayoutCache::Get(customText.Text, customText.Size, customText.Style);
+			const auto& bounds = layout.Bounds;
+			auto textPosition = position;
+			sf::Vector2f origin(0.f, 0.f);
 
 			if (_centered)
 			{
-				const auto bounds = text.getGlobalBounds();
-				text.setOrigin(bounds.width / 2, bounds.height * 0.75f);
+				origin = sf::Vector2f(bounds.width / 2, bounds.height * 0.75f);
 			}
 
 			if (maxX > 0.f)
 			{
-				const auto bounds = text.getLocalBounds();
-
 				if (position.x - baseX + bounds.width > maxX)
 				{
 					position.x = baseX;
 					position.y += maxHeight * 1.5f;
-					text.setPosition(position);
+					textPosition = position;
 				}
 			}
 
-			_texts.push_back(text);
+			_glyphs.Add(layout, textPosition - origin, customText.Color);
 
-			position.x += text.getLocalBounds().width + text.getCharacterSize() / 5;
+			position.x += bounds.width + static_cast<float>(customText.Size / 5);
 
-			if (text.getLocalBounds().height > maxHeight)
+			if (bounds.height > maxHeight)
 			{
-				maxHeight = text.getLocalBounds().height;
+				maxHeight = bounds.height;
 			}
 		}
 
@@ -67,16 +48,15 @@ Text::Text(sf::Vector2f position, const std::vector<TextLine>& texts, float maxX
 
 void Text::draw(sf::RenderTarget& target, const sf::RenderStates states) const
 {
-	for (auto& text : _texts)
-	{
-		target.draw(text, states);
-	}
+	target.draw(_glyphs, states);
 }
 
 void Text::SetColor(const sf::Color& color)
 {
-	for (auto& text : _texts)
-	{
-		text.setFillColor(color);
-	}
+	_glyphs.SetColor(color);
+}
+
+void Text::AddTo(GlyphBatch& glyphBatch) const
+{
+	glyphBatch.Add(_glyphs);
 }
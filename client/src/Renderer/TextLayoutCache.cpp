@@ -0,0 +1,172 @@
+#include "Renderer/TextLayoutCache.h"
+
+#include "AssetManager.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace TextLayoutCache
+{
+	/**
+	 * @brief Horizontal offset of the top of a glyph per pixel of height, the shear sf::Text uses for italic
+	 */
+	static constexpr float ITALIC_SHEAR = 0.209f;
+	/**
+	 * @brief Pixels around a glyph in the font texture, kept in the quad to not cut the smoothed edges
+	 */
+	static constexpr float GLYPH_PADDING = 1.f;
+
+	struct LayoutKey
+	{
+		std::string String;
+		unsigned CharacterSize;
+		sf::Uint32 Style;
+
+		bool operator==(const LayoutKey& other) const = default;
+	};
+
+	struct LayoutKeyHash
+	{
+		std::size_t operator()(const LayoutKey& key) const noexcept
+		{
+			auto hash = std::hash<std::string>()(key.String);
+			hash ^= (static_cast<std::size_t>(key.CharacterSize) << 8 | key.Style) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+			return hash;
+		}
+	};
+
+	static std::unordered_map<LayoutKey, TextLayout, LayoutKeyHash> layouts;
+
+	static void addGlyphQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f position, const sf::Glyph& glyph, float italicShear)
+	{
+		const float left = glyph.bounds.left - GLYPH_PADDING;
+		const float top = glyph.bounds.top - GLYPH_PADDING;
+		const float right = glyph.bounds.left + glyph.bounds.width + GLYPH_PADDING;
+		const float bottom = glyph.bounds.top + glyph.bounds.height + GLYPH_PADDING;
+
+		const float u1 = static_cast<float>(glyph.textureRect.left) - GLYPH_PADDING;
+		const float v1 = static_cast<float>(glyph.textureRect.top) - GLYPH_PADDING;
+		const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + GLYPH_PADDING;
+		const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + GLYPH_PADDING;
+
+		const sf::Vertex topLeft(sf::Vector2f(position.x + left - italicShear * top, position.y + top), sf::Color::White, sf::Vector2f(u1, v1));
+		const sf::Vertex topRight(sf::Vector2f(position.x + right - italicShear * top, position.y + top), sf::Color::White, sf::Vector2f(u2, v1));
+		const sf::Vertex bottomLeft(sf::Vector2f(position.x + left - italicShear * bottom, position.y + bottom), sf::Color::White, sf::Vector2f(u1, v2));
+		const sf::Vertex bottomRight(sf::Vector2f(position.x + right - italicShear * bottom, position.y + bottom), sf::Color::White, sf::Vector2f(u2, v2));
+
+		vertices.push_back(topLeft);
+		vertices.push_back(topRight);
+		vertices.push_back(bottomLeft);
+		vertices.push_back(bottomLeft);
+		vertices.push_back(topRight);
+		vertices.push_back(bottomRight);
+	}
+
+	static TextLayout layoutWithMainFont(const std::string& string, unsigned characterSize, sf::Text::Style style)
+	{
+		return Layout(AssetManager::GetMainFont(), string, characterSize, style);
+	}
+
+	const TextLayout& Get(const std::string& string, unsigned characterSize, sf::Text::Style style)
+	{
+		static const TextLayout emptyLayout;
+
+		if (!AssetManager::IsInitialized()) return emptyLayout;
+
+		return Get(string, characterSize, style, layoutWithMainFont);
+	}
+
+	const TextLayout& Get(const std::string& string, unsigned characterSize, sf::Text::Style style, LayoutFunction layoutFunction)
+	{
+		LayoutKey key { string, characterSize, static_cast<sf::Uint32>(style) };
+		const auto it = layouts.find(key);
+
+		if (it != layouts.end()) return it->second;
+
+		auto layout = layoutFunction(string, characterSize, style);
+
+		return layouts.emplace(std::move(key), std::move(layout)).first->second;
+	}
+
+	TextLayout Layout(const sf::Font& font, const std::string& string, unsigned characterSize, sf::Text::Style style)
+	{
+		TextLayout layout;
+		layout.CharacterSize = characterSize;
+
+		if (string.empty()) return layout;
+
+		const bool isBold = (style & sf::Text::Style::Bold) != 0;
+		const float italicShear = (style & sf::Text::Style::Italic) != 0 ? ITALIC_SHEAR : 0.f;
+		const float whitespaceWidth = font.getGlyph(L' ', characterSize, isBold).advance;
+		const float lineSpacing = font.getLineSpacing(characterSize);
+		const auto size = static_cast<float>(characterSize);
+
+		float x = 0.f;
+		float y = size;
+		float minX = size;
+		float minY = size;
+		float maxX = 0.f;
+		float maxY = 0.f;
+		sf::Uint32 previousCharacter = 0;
+
+		layout.Vertices.reserve(string.size() * 6);
+
+		for (const auto character : string)
+		{
+			const auto codePoint = static_cast<sf::Uint32>(static_cast<unsigned char>(character));
+
+			x += font.getKerning(previousCharacter, codePoint, characterSize);
+			previousCharacter = codePoint;
+
+			if (codePoint == L' ' || codePoint == L'\t' || codePoint == L'\n')
+			{
+				minX = std::min(minX, x);
+				minY = std::min(minY, y);
+
+				switch (codePoint)
+				{
+					case L' ': x += whitespaceWidth; break;
+					case L'\t': x += whitespaceWidth * 4; break;
+					case L'\n': y += lineSpacing; x = 0; break;
+					default: break;
+				}
+
+				maxX = std::max(maxX, x);
+				maxY = std::max(maxY, y);
+
+				continue;
+			}
+
+			const auto& glyph = font.getGlyph(codePoint, characterSize, isBold);
+
+			addGlyphQuad(layout.Vertices, sf::Vector2f(x, y), glyph, italicShear);
+
+			const float left = glyph.bounds.left;
+			const float top = glyph.bounds.top;
+			const float right = glyph.bounds.left + glyph.bounds.width;
+			const float bottom = glyph.bounds.top + glyph.bounds.height;
+
+			minX = std::min(minX, x + left - italicShear * bottom);
+			maxX = std::max(maxX, x + right - italicShear * top);
+			minY = std::min(minY, y + top);
+			maxY = std::max(maxY, y + bottom);
+
+			x += glyph.advance;
+		}
+
+		layout.Bounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+
+		return layout;
+	}
+
+	std::size_t GetSize()
+	{
+		return layouts.size();
+	}
+
+	void Clear()
+	{
+		layouts.clear();
+	}
+}
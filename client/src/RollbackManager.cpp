@@ -5,10 +5,46 @@
 #include "MyPackets/PlayerInputPacket.h"
 #include "MyPackets/StartGamePacket.h"
 #include "Logger.h"
+#include "Profiler.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <utility>
 
-RollbackManager::RollbackManager()
+#ifdef TRACY_ENABLE
+#include <tracy/Tracy.hpp>
+#endif
+
+namespace
+{
+	/**
+	 * @brief Weight of a new sample in the smoothed confirmation latency
+	 */
+	constexpr float CONFIRMATION_LATENCY_SMOOTHING = 0.1f;
+	/**
+	 * @brief Share of the confirmation latency hidden by the input delay. Below 1, the confirmations mostly arrive after
+	 * their frame has been simulated, as the remote inputs arrive about when the local ones are confirmed. The rounding of
+	 * a short latency can still give a delay as long as it
+	 */
+	constexpr float INPUT_DELAY_LATENCY_SHARE = 0.5f;
+	/**
+	 * @brief Ticks between two changes of the input delay, so a latency spike does not make it jump
+	 */
+	constexpr int INPUT_DELAY_CHANGE_INTERVAL = PHYSICAL_FRAME_RATE;
+	/**
+	 * @brief Share of FIXED_TIME_STEP a fixed update is stretched by per frame ahead of the other client
+	 */
+	constexpr float TIME_SYNC_STRETCH_PER_FRAME = 0.02f;
+	/**
+	 * @brief Frames ahead or behind under which the fixed updates keep their duration, the estimate is not more precise
+	 */
+	constexpr float TIME_SYNC_DEAD_ZONE = 1.f;
+
+	const RepeatLastInputPredictor repeatLastInputPredictor;
+}
+
+RollbackManager::RollbackManager() : _inputPredictor(&repeatLastInputPredictor)
 {
 	_confirmedFrames.reserve(2'000);
 }
@@ -18,6 +54,15 @@ void RollbackManager::OnPacketReceived(Packet& packet)
 	if (packet.Type == static_cast<char>(MyPackets::MyPacketType::ConfirmationInput))
 	{
 		auto& confirmationInputPacket = *packet.As<MyPackets::ConfirmInputPacket>();
+		const auto otherPlayerNumber = _localPlayerNumber == PlayerNumber::PLAYER1 ? PlayerNumber::PLAYER2 : PlayerNumber::PLAYER1;
+		// Without remote inputs waiting, the remote input of the confirmed frame was predicted
+		const auto isRemoteInputPredicted = _lastRemotePlayerInputs.empty();
+		const auto frame = static_cast<int>(_confirmedFrames.size());
+
+		if (isRemoteInputPredicted)
+		{
+			saveSimulatedRemoteInputs(otherPlayerNumber);
+		}
 
 		_confirmedFrames.push_back({
 			{ confirmationInputPacket.Player1Input, confirmationInputPacket.Player2Input },
@@ -27,43 +72,54 @@ void RollbackManager::OnPacketReceived(Packet& packet)
 		if (!_localPlayerInputs.empty())
 		{
 			_localPlayerInputs.erase(_localPlayerInputs.begin());
+
+			// The delayed inputs of the next frames are already confirmed, the current frame catches up with the confirmed one
+			_inputDelay = std::min(_inputDelay, static_cast<int>(_localPlayerInputs.size()));
+		}
+
+		if (!_localInputTicks.empty())
+		{
+			const auto latency = static_cast<float>(_localTick - _localInputTicks.front());
+			_localInputTicks.erase(_localInputTicks.begin());
+
+			_confirmationLatency = _confirmationLatency < 0.f ? latency
+				: _confirmationLatency + (latency - _confirmationLatency) * CONFIRMATION_LATENCY_SMOOTHING;
 		}
 
-		if (!_lastRemotePlayerInputs.empty())
+		if (!isRemoteInputPredicted)
 		{
 			_lastRemotePlayerInputs.erase(_lastRemotePlayerInputs.begin());
 
-			if (!_unconfirmedGameData.empty() && !_needToRollback)
+			if (_unconfirmedGameDataCount > 0 && !_needToRollback)
 			{
-				_confirmedGameData = _unconfirmedGameData.front();
-				_unconfirmedGameData.erase(_unconfirmedGameData.begin());
-				_lastConfirmedFrame++;
-
-				_integrityIsOk = _confirmedGameData.GenerateChecksum() == _confirmedFrames.back().Checksum;
+				confirmUnconfirmedGameData();
 			}
 		}
 		else
 		{
-			// If we don't have any remote inputs, we need to check if last remote inputs are the same as the last confirmed inputs
-			const auto otherPlayerNumber = _localPlayerNumber == PlayerNumber::PLAYER1 ? PlayerNumber::PLAYER2 : PlayerNumber::PLAYER1;
+			// If we don't have any remote inputs, we need to check if the predicted remote inputs are the same as the confirmed ones
 			PlayerInput currentInput = _localPlayerNumber == PlayerNumber::PLAYER1 ? confirmationInputPacket.Player2Input : confirmationInputPacket.Player1Input;
-			PlayerInput lastInput = GetPlayerInput(otherPlayerNumber, _confirmedFrames.size() - 2);
 
-			if (lastInput != currentInput)
+			addPrediction(frame, currentInput);
+
+			const auto simulationChange = _needToRollback ? SimulationChange::NONE : getSimulationChange(otherPlayerNumber);
+
+			if (simulationChange == SimulationChange::RELEVANT)
 			{
 				_needToRollback = true;
 			}
-			else if (!_unconfirmedGameData.empty() && !_needToRollback)
+			else
 			{
-				_confirmedGameData = _unconfirmedGameData.front();
-				_unconfirmedGameData.erase(_unconfirmedGameData.begin());
-				_lastConfirmedFrame++;
+				if (simulationChange == SimulationChange::IRRELEVANT) _skippedRollbackCount++;
 
-				_integrityIsOk = _confirmedGameData.GenerateChecksum() == _confirmedFrames.back().Checksum;
+				if (_unconfirmedGameDataCount > 0 && !_needToRollback)
+				{
+					confirmUnconfirmedGameData();
+				}
 			}
 		}
 
-		if (_lastConfirmedFrame != _confirmedFrames.size())
+		if (GetConfirmedFrame() != static_cast<int>(_confirmedFrames.size()))
 		{
 			_needToRollback = true;
 		}
@@ -72,25 +128,39 @@ void RollbackManager::OnPacketReceived(Packet& packet)
 	{
 		auto& playerInputPacket = *packet.As<MyPackets::PlayerInputPacket>();
 
+		// The packets are sent in UDP, an older one can arrive after a newer one
+		if (playerInputPacket.CurrentFrame >= _remoteFrame)
+		{
+			_remoteFrame = playerInputPacket.CurrentFrame;
+			_remoteFrameAdvantage = playerInputPacket.FrameAdvantage;
+		}
+
 		if (playerInputPacket.LastInputs.empty() || _confirmedFrames.empty()) return;
 
 		const auto& lastInputs = playerInputPacket.LastInputs;
 		const auto otherPlayerNumber = _localPlayerNumber == PlayerNumber::PLAYER1 ? PlayerNumber::PLAYER2 : PlayerNumber::PLAYER1;
 
+		saveSimulatedRemoteInputs(otherPlayerNumber);
+
 		for (auto lastInput : lastInputs)
 		{
 			if (lastInput.Frame < _confirmedFrames.size() + _lastRemotePlayerInputs.size()) continue;
 
-			const auto frame = lastInput.Frame;
-			PlayerInput lastRemoteInput = GetPlayerInput(otherPlayerNumber, frame);
-
-			if (lastRemoteInput != lastInput.Input)
-			{
-				_needToRollback = true;
-			}
+			// Against the input the frame was simulated with, the history now holds the earlier inputs of the packet
+			addPrediction(lastInput.Frame, lastInput.Input);
 
 			_lastRemotePlayerInputs.push_back(lastInput);
 		}
+
+		// The inputs of the frames not simulated yet arrived early enough, thanks to the input delay of the other player,
+		// and the keys that had no effect on the simulated frames are not worth a rollback
+		if (!_needToRollback)
+		{
+			const auto simulationChange = getSimulationChange(otherPlayerNumber);
+
+			if (simulationChange == SimulationChange::RELEVANT) _needToRollback = true;
+			else if (simulationChange == SimulationChange::IRRELEVANT) _skippedRollbackCount++;
+		}
 	}
 	else if (packet.Type == static_cast<char>(MyPackets::MyPacketType::StartGame))
 	{
@@ -102,7 +172,55 @@ void RollbackManager::OnPacketReceived(Packet& packet)
 
 void RollbackManager::AddPlayerInputs(PlayerInput playerInput)
 {
+	_localTick++;
+
+	// The keys read while the current frame did not advance are added to the next input, so a short press is not lost
+	playerInput = static_cast<PlayerInput>(playerInput | _pendingLocalInput);
+
+	// Wait for the confirmations rather than predict further, the rollback to do when they arrive would not fit in a fixed update
+	if (GetPredictedFrameCount() >= MAX_PREDICTION_FRAMES)
+	{
+		_stallCount++;
+		_pendingLocalInput = playerInput;
+
+		return;
+	}
+
+	const auto delayChange = updateInputDelay();
+
+	// The next frame already has an input
+	if (delayChange < 0)
+	{
+		_pendingLocalInput = playerInput;
+
+		return;
+	}
+
+	_pendingLocalInput = {};
+
+	if (delayChange > 0)
+	{
+		_localPlayerInputs.push_back(_localPlayerInputs.empty() ? playerInput : _localPlayerInputs.back());
+		_localInputTicks.push_back(_localTick);
+	}
+
 	_localPlayerInputs.push_back(playerInput);
+	_localInputTicks.push_back(_localTick);
+}
+
+int RollbackManager::updateInputDelay()
+{
+	if (_confirmationLatency < 0.f || _localTick - _lastInputDelayChangeTick < INPUT_DELAY_CHANGE_INTERVAL) return 0;
+
+	const auto targetDelay = std::clamp(static_cast<int>(std::lround(_confirmationLatency * INPUT_DELAY_LATENCY_SHARE)), 0, _maxInputDelay);
+
+	if (targetDelay == _inputDelay) return 0;
+
+	const auto delayChange = targetDelay > _inputDelay ? 1 : -1;
+	_inputDelay += delayChange;
+	_lastInputDelayChangeTick = _localTick;
+
+	return delayChange;
 }
 
 std::vector<PlayerInputPerFrame> RollbackManager::GetLastLocalPlayerInputs()
@@ -123,72 +241,191 @@ PlayerInput RollbackManager::GetPlayerInput(PlayerNumber playerNumber, int frame
 {
 	if (frame < 0) return {};
 
+	const auto knownCount = getKnownInputCount(playerNumber);
+
+	if (knownCount == 0) return {};
+
+	if (static_cast<std::size_t>(frame) < knownCount) return getKnownInput(playerNumber, frame);
+
 	// If we are asking for the local player, we need to check if we are the local player 1 or 2
-	const auto askForLocalPlayer = playerNumber == _localPlayerNumber;
-	// Inputs asked are all the inputs that we need to ask for the frame
-	std::vector<PlayerInput> inputsAsked = {};
+	if (playerNumber == _localPlayerNumber) return getKnownInput(playerNumber, knownCount - 1);
+
+	return predictRemoteInput(playerNumber, frame, knownCount);
+}
+
+std::size_t RollbackManager::getKnownInputCount(PlayerNumber playerNumber) const
+{
+	// The inputs known for the frames are the confirmed ones followed by the local or the last remote ones
+	return _confirmedFrames.size() + (playerNumber == _localPlayerNumber ? _localPlayerInputs.size() : _lastRemotePlayerInputs.size());
+}
 
-	inputsAsked.reserve(_confirmedFrames.size() + _localPlayerInputs.size());
+PlayerInput RollbackManager::getKnownInput(PlayerNumber playerNumber, std::size_t frame) const
+{
+	const auto confirmedCount = _confirmedFrames.size();
 
-	for (auto confirmedPlayerInput : _confirmedFrames)
+	if (frame < confirmedCount)
 	{
-		inputsAsked.push_back(playerNumber == PlayerNumber::PLAYER1 ? confirmedPlayerInput.Inputs.Player1Input : confirmedPlayerInput.Inputs.Player2Input);
+		const auto& inputs = _confirmedFrames[frame].Inputs;
+
+		return playerNumber == PlayerNumber::PLAYER1 ? inputs.Player1Input : inputs.Player2Input;
 	}
 
-	if (askForLocalPlayer)
+	return playerNumber == _localPlayerNumber ? _localPlayerInputs[frame - confirmedCount] : _lastRemotePlayerInputs[frame - confirmedCount].Input;
+}
+
+PlayerInput RollbackManager::predictRemoteInput(PlayerNumber playerNumber, int frame, std::size_t knownCount) const
+{
+	std::array<PlayerInput, INPUT_PREDICTION_HISTORY> history {};
+	const auto historySize = std::min(knownCount, INPUT_PREDICTION_HISTORY);
+
+	for (std::size_t i = 0; i < historySize; i++)
 	{
-		for (auto localPlayerInput : _localPlayerInputs)
-		{
-			inputsAsked.push_back(localPlayerInput);
-		}
+		history[i] = getKnownInput(playerNumber, knownCount - historySize + i);
 	}
-	else
+
+	return _inputPredictor->Predict(std::span<const PlayerInput>(history.data(), historySize), frame - static_cast<int>(knownCount) + 1);
+}
+
+void RollbackManager::saveSimulatedRemoteInputs(PlayerNumber remotePlayerNumber)
+{
+	// The input of the frame before the first one is known, so it does not change as a previous input
+	_simulatedRemoteInputsFirstFrame = static_cast<int>(getKnownInputCount(remotePlayerNumber));
+	_simulatedRemoteInputsCount = std::max(GetCurrentFrame() - _simulatedRemoteInputsFirstFrame + 1, 0);
+
+	if (_simulatedRemoteInputsCount > static_cast<int>(_simulatedRemoteInputs.size()))
 	{
-		for (auto lastRemotePlayerInput : _lastRemotePlayerInputs)
-		{
-			inputsAsked.push_back(lastRemotePlayerInput.Input);
-		}
+		_simulatedRemoteInputsCount = -1;
+
+		return;
+	}
+
+	for (int i = 0; i < _simulatedRemoteInputsCount; i++)
+	{
+		_simulatedRemoteInputs[i] = GetPlayerInput(remotePlayerNumber, _simulatedRemoteInputsFirstFrame + i);
+	}
+}
+
+RollbackManager::SimulationChange RollbackManager::getSimulationChange(PlayerNumber remotePlayerNumber) const
+{
+	if (_simulatedRemoteInputsCount < 0) return SimulationChange::RELEVANT;
+
+	auto simulationChange = SimulationChange::NONE;
+
+	for (int i = 0; i < _simulatedRemoteInputsCount; i++)
+	{
+		const auto frame = _simulatedRemoteInputsFirstFrame + i;
+		const auto inputChange = static_cast<PlayerInput>(*getSimulatedRemoteInput(frame) ^ GetPlayerInput(remotePlayerNumber, frame));
+		const auto previousInputChange = i == 0 ? PlayerInput {}
+			: static_cast<PlayerInput>(*getSimulatedRemoteInput(frame - 1) ^ GetPlayerInput(remotePlayerNumber, frame - 1));
 
-		if (inputsAsked.empty()) return {};
+		if (inputChange == 0 && previousInputChange == 0) continue;
 
-		const std::size_t remoteInputsToReplicate = _localPlayerInputs.size() - _lastRemotePlayerInputs.size();
-		const PlayerInput inputToReplicate = inputsAsked.back();
+		// The keys that matter depend on the game data the frame was simulated from
+		const auto* gameData = findGameData(frame - 1);
 
-		for (std::size_t i = 0; i < remoteInputsToReplicate; i++)
+		if (gameData == nullptr) return SimulationChange::RELEVANT;
+
+		if ((inputChange & gameData->GetRemoteRelevantInputs(false)) != 0 || (previousInputChange & gameData->GetRemoteRelevantInputs(true)) != 0)
 		{
-			inputsAsked.push_back(inputToReplicate);
+			return SimulationChange::RELEVANT;
 		}
+
+		simulationChange = SimulationChange::IRRELEVANT;
 	}
 
-	if (inputsAsked.empty()) return {};
+	return simulationChange;
+}
+
+const ClientGameData* RollbackManager::findGameData(int frame) const
+{
+	if (frame < 0) return nullptr;
+
+	if (frame == _confirmedGameDataFrame) return &_confirmedGameData;
 
-	if (frame < inputsAsked.size())
+	for (std::size_t i = 0; i < _unconfirmedGameDataCount; i++)
 	{
-		return inputsAsked[frame];
+		const auto& snapshot = _unconfirmedGameData[(_unconfirmedGameDataStart + i) % _unconfirmedGameData.size()];
+
+		if (snapshot.Frame == frame) return &snapshot.GameData;
 	}
 
-	return inputsAsked.back();
+	return nullptr;
+}
+
+void RollbackManager::addPrediction(int frame, PlayerInput input)
+{
+	// The inputs arrived before their frame was simulated did not need a prediction
+	if (frame > GetCurrentFrame()) return;
+
+	const auto simulatedInput = getSimulatedRemoteInput(frame);
+
+	if (!simulatedInput) return;
+
+	_inputPredictionStatistics.Predictions++;
+
+	if (*simulatedInput != input) _inputPredictionStatistics.Mispredictions++;
+}
+
+std::optional<PlayerInput> RollbackManager::getSimulatedRemoteInput(int frame) const
+{
+	const auto index = frame - _simulatedRemoteInputsFirstFrame;
+
+	if (index < 0 || index >= _simulatedRemoteInputsCount) return std::nullopt;
+
+	return _simulatedRemoteInputs[index];
 }
 
 short RollbackManager::GetCurrentFrame() const
 {
-	return static_cast<short>(_confirmedFrames.size() + _localPlayerInputs.size() - 1);
+	return static_cast<short>(static_cast<int>(_confirmedFrames.size() + _localPlayerInputs.size()) - 1 - _inputDelay);
+}
+
+int RollbackManager::GetPredictedFrameCount() const
+{
+	return std::max(GetCurrentFrame() + 1 - static_cast<int>(_confirmedFrames.size()), 0);
+}
+
+int RollbackManager::GetLocalFrameAdvantage() const
+{
+	if (_remoteFrame < 0) return 0;
+
+	return GetCurrentFrame() - _remoteFrame;
+}
+
+float RollbackManager::GetFixedTimeStep() const
+{
+	if (_remoteFrame < 0) return FIXED_TIME_STEP;
+
+	// The latency counts in both advantages, half of their difference is the frames the local client is ahead
+	const auto framesAhead = static_cast<float>(GetLocalFrameAdvantage() - _remoteFrameAdvantage) / 2.f;
+
+	if (std::abs(framesAhead) < TIME_SYNC_DEAD_ZONE) return FIXED_TIME_STEP;
+
+	const auto stretch = std::clamp(framesAhead * TIME_SYNC_STRETCH_PER_FRAME, -MAX_TIME_SYNC_STRETCH, MAX_TIME_SYNC_STRETCH);
+
+	return FIXED_TIME_STEP * (1.f + stretch);
 }
 
-void RollbackManager::SetConfirmedGameData(ClientGameData gameData)
+void RollbackManager::SetConfirmedGameData(const ClientGameData& gameData, int frame)
 {
-	_confirmedGameData = std::move(gameData);
-	_lastConfirmedFrame++;
+	_confirmedGameData = gameData;
+	_confirmedGameDataFrame = frame;
 }
 
-ClientGameData RollbackManager::GetConfirmedGameData() const
+const ClientGameData& RollbackManager::GetConfirmedGameData() const
 {
 	return _confirmedGameData;
 }
 
 int RollbackManager::GetConfirmedFrame() const
 {
-	return _lastConfirmedFrame;
+	return _confirmedGameDataFrame + 1;
+}
+
+int RollbackManager::GetLastRollbackFrame() const
+{
+	// With an input delay as long as the confirmation latency, a frame can be confirmed before it is simulated
+	return std::max(GetCurrentFrame() - 1, static_cast<int>(_confirmedFrames.size()) - 1);
 }
 
 short RollbackManager::GetConfirmedInputFrame() const
@@ -198,12 +435,108 @@ short RollbackManager::GetConfirmedInputFrame() const
 
 void RollbackManager::ResetUnconfirmedGameData()
 {
-	_unconfirmedGameData.clear();
+	_unconfirmedGameDataStart = 0;
+	_unconfirmedGameDataCount = 0;
+}
+
+void RollbackManager::AddUnconfirmedGameData(const ClientGameData& gameData, int frame)
+{
+	if (_unconfirmedGameDataCount < _unconfirmedGameData.size())
+	{
+		auto& snapshot = _unconfirmedGameData[(_unconfirmedGameDataStart + _unconfirmedGameDataCount) % _unconfirmedGameData.size()];
+		snapshot.GameData = gameData;
+		snapshot.Frame = frame;
+		_unconfirmedGameDataCount++;
+
+		return;
+	}
+
+	// All the slots are used, put the oldest first to add a slot after the newest one
+	std::rotate(_unconfirmedGameData.begin(), _unconfirmedGameData.begin() + static_cast<std::ptrdiff_t>(_unconfirmedGameDataStart), _unconfirmedGameData.end());
+	_unconfirmedGameDataStart = 0;
+
+	_unconfirmedGameData.push_back({ gameData, frame });
+	_unconfirmedGameDataCount++;
+}
+
+void RollbackManager::confirmUnconfirmedGameData()
+{
+	const auto& snapshot = _unconfirmedGameData[_unconfirmedGameDataStart];
+	_confirmedGameData = snapshot.GameData;
+	_confirmedGameDataFrame = snapshot.Frame;
+	_unconfirmedGameDataStart = (_unconfirmedGameDataStart + 1) % _unconfirmedGameData.size();
+	_unconfirmedGameDataCount--;
+
+	_integrityIsOk = _confirmedGameData.GenerateChecksum() == _confirmedFrames.back().Checksum;
+}
+
+void RollbackManager::SimulateFrames(RollbackSimulation& simulation)
+{
+	if (_needToRollback)
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(rollbackZone, "Rollback", true);
+#endif
+		PROFILE_SCOPE(rollbackProfile, "Rollback");
+		static auto& rollbackDepthHistogram = Profiler::GetHistogram("Rollback::depth", ProfileUnit::Count);
+
+		// The confirmed frame of the last set of confirmed game data
+		const auto oldConfirmedFrame = GetConfirmedFrame();
+		const auto confirmedInputFrame = GetConfirmedInputFrame();
+		const auto lastRollbackFrame = GetLastRollbackFrame();
+
+		const auto rollbackDepth = std::max(GetCurrentFrame() - oldConfirmedFrame, 0);
+		rollbackDepthHistogram.AddSample(static_cast<std::uint64_t>(rollbackDepth));
+
+		simulation.SetGameData(_confirmedGameData);
+		ResetUnconfirmedGameData();
+
+		// Rollback before the current frame, and up to the last confirmed frame if it was not simulated yet
+		for (auto frame = oldConfirmedFrame; frame <= lastRollbackFrame; frame++)
+		{
+			simulateFrame(simulation, frame, true);
+
+			// Happens when rollback is happening by reception of a confirmed input without remote inputs
+			// So, it needs to update the confirmed game data when validating the confirmed input
+			if (frame < confirmedInputFrame)
+			{
+				{
+					PROFILE_SCOPE(snapshotProfile, "Rollback::snapshot");
+					SetConfirmedGameData(simulation.GetGameData(), frame);
+				}
+
+				CheckIntegrity(frame);
+			}
+			else
+			{
+				PROFILE_SCOPE(snapshotProfile, "Rollback::snapshot");
+				AddUnconfirmedGameData(simulation.GetGameData(), frame);
+			}
+		}
+
+		RollbackDone(rollbackDepth);
+		_lastSimulatedFrame = lastRollbackFrame;
+	}
+
+	const auto currentFrame = GetCurrentFrame();
+
+	// The current frame does not change while waiting for the confirmations, it is already simulated
+	if (currentFrame > _lastSimulatedFrame)
+	{
+		simulateFrame(simulation, currentFrame, false);
+		_lastSimulatedFrame = currentFrame;
+
+		PROFILE_SCOPE(snapshotProfile, "Rollback::snapshot");
+		AddUnconfirmedGameData(simulation.GetGameData(), currentFrame);
+	}
 }
 
-void RollbackManager::AddUnconfirmedGameData(ClientGameData gameData)
+void RollbackManager::simulateFrame(RollbackSimulation& simulation, int frame, bool isRollback) const
 {
-	_unconfirmedGameData.push_back(std::move(gameData));
+	const FinalInputs inputs = { GetPlayerInput(PlayerNumber::PLAYER1, frame), GetPlayerInput(PlayerNumber::PLAYER2, frame) };
+	const FinalInputs previousInputs = { GetPlayerInput(PlayerNumber::PLAYER1, frame - 1), GetPlayerInput(PlayerNumber::PLAYER2, frame - 1) };
+
+	simulation.SimulateFrame(inputs, previousInputs, isRollback);
 }
 
 bool RollbackManager::NeedToRollback() const
@@ -211,10 +544,72 @@ bool RollbackManager::NeedToRollback() const
 	return _needToRollback;
 }
 
-void RollbackManager::RollbackDone()
+void RollbackManager::RollbackDone(int depth)
 {
 	_needToRollback = false;
-	_lastConfirmedFrame = static_cast<int>(_confirmedFrames.size());
+
+	// Only simulating the frames confirmed before being simulated is not a rollback
+	if (depth == 0) return;
+
+	_rollbackCount++;
+	_rolledBackFrames += static_cast<std::uint64_t>(depth);
+}
+
+void RollbackManager::SetMaxInputDelay(int maxInputDelay)
+{
+	_maxInputDelay = std::max(maxInputDelay, 0);
+}
+
+int RollbackManager::GetInputDelay() const
+{
+	return _inputDelay;
+}
+
+float RollbackManager::GetConfirmationLatency() const
+{
+	return std::max(_confirmationLatency, 0.f);
+}
+
+std::uint64_t RollbackManager::GetRollbackCount() const
+{
+	return _rollbackCount;
+}
+
+void RollbackManager::SetInputPredictor(const InputPredictor& inputPredictor)
+{
+	_inputPredictor = &inputPredictor;
+}
+
+const InputPredictor& RollbackManager::GetInputPredictor() const
+{
+	return *_inputPredictor;
+}
+
+const InputPredictionStatistics& RollbackManager::GetInputPredictionStatistics() const
+{
+	return _inputPredictionStatistics;
+}
+
+std::uint64_t RollbackManager::GetRolledBackFrames() const
+{
+	return _rolledBackFrames;
+}
+
+std::uint64_t RollbackManager::GetSkippedRollbackCount() const
+{
+	return _skippedRollbackCount;
+}
+
+std::uint64_t RollbackManager::GetStallCount() const
+{
+	return _stallCount;
+}
+
+float RollbackManager::GetAverageRollbackDepth() const
+{
+	if (_rollbackCount == 0) return 0.f;
+
+	return static_cast<float>(_rolledBackFrames) / static_cast<float>(_rollbackCount);
 }
 
 void RollbackManager::CheckIntegrity(int frame)
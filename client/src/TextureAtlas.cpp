@@ -0,0 +1,214 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+namespace
+{
+	std::filesystem::path withExtension(const std::filesystem::path& cachePath, const char* extension)
+	{
+		auto path = cachePath;
+		path += extension;
+
+		return path;
+	}
+
+	/**
+	 * @brief All the PNGs of the directory except the cached atlas, sorted to always pack them in the same order
+	 */
+	std::vector<std::filesystem::path> listImages(const std::filesystem::path& directory, const std::filesystem::path& cachePath)
+	{
+		std::vector<std::filesystem::path> images;
+		std::error_code error;
+		const auto cacheImagePath = withExtension(cachePath, ".png");
+
+		for (auto it = std::filesystem::recursive_directory_iterator(directory, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+		{
+			if (!it->is_regular_file() || it->path().extension() != ".png") continue;
+
+			std::error_code cacheError;
+
+			if (std::filesystem::equivalent(it->path(), cacheImagePath, cacheError)) continue;
+
+			images.push_back(it->path());
+		}
+
+		std::sort(images.begin(), images.end());
+
+		return images;
+	}
+}
+
+bool TextureAtlas::build(const std::filesystem::path& directory, const std::vector<std::filesystem::path>& paths, sf::Image& image)
+{
+	std::vector<sf::Image> images(paths.size());
+	std::vector<sf::Vector2u> sizes(paths.size());
+
+	for (std::size_t i = 0; i < paths.size(); i++)
+	{
+		if (!images[i].loadFromFile(paths[i].string())) return false;
+
+		sizes[i] = images[i].getSize();
+	}
+
+	sf::Vector2u atlasSize;
+	const auto rects = Pack(sizes, MAX_WIDTH, atlasSize);
+
+	image.create(std::max(atlasSize.x, 1u), std::max(atlasSize.y, 1u), sf::Color::Transparent);
+	_textureRects.clear();
+
+	for (std::size_t i = 0; i < paths.size(); i++)
+	{
+		const auto name = paths[i].lexically_relative(directory).replace_extension().generic_string();
+
+		image.copy(images[i], rects[i].left, rects[i].top);
+		_textureRects[name] = rects[i];
+	}
+
+	return true;
+}
+
+bool TextureAtlas::loadCache(const std::filesystem::path& cachePath)
+{
+	if (!_texture.loadFromFile(withExtension(cachePath, ".png").string())) return false;
+
+	return ReadLayout(withExtension(cachePath, ".txt"), _textureRects);
+}
+
+bool TextureAtlas::saveCache(const std::filesystem::path& cachePath, const sf::Image& image) const
+{
+	std::error_code error;
+	std::filesystem::create_directories(cachePath.parent_path(), error);
+
+	if (!image.saveToFile(withExtension(cachePath, ".png").string())) return false;
+
+	// Written after the image, so the layout is never older than the image it describes
+	return WriteLayout(withExtension(cachePath, ".txt"), _textureRects);
+}
+
+bool TextureAtlas::Load(const std::filesystem::path& directory, const std::filesystem::path& cachePath)
+{
+	const auto paths = listImages(directory, cachePath);
+
+	// An image added or removed since the cache was written changes the count
+	if (IsCacheUpToDate(directory, cachePath) && loadCache(cachePath) && _textureRects.size() == paths.size()) return true;
+
+	sf::Image image;
+
+	if (!build(directory, paths, image)) return false;
+	if (!_texture.loadFromImage(image)) return false;
+
+	// A cache that can not be written only costs the decoding of the PNGs at the next start
+	saveCache(cachePath, image);
+
+	return true;
+}
+
+sf::IntRect TextureAtlas::GetTextureRect(const std::string& name) const
+{
+	const auto it = _textureRects.find(name);
+
+	return it != _textureRects.end() ? it->second : sf::IntRect();
+}
+
+std::vector<sf::IntRect> TextureAtlas::Pack(const std::vector<sf::Vector2u>& sizes, unsigned maxWidth, sf::Vector2u& atlasSize)
+{
+	std::vector<sf::IntRect> rects(sizes.size());
+	std::vector<std::size_t> order(sizes.size());
+	std::iota(order.begin(), order.end(), 0);
+
+	// Tallest first, so the images of a shelf have close heights and waste little space
+	std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+		return sizes[a].y > sizes[b].y;
+	});
+
+	unsigned x = 0;
+	unsigned y = 0;
+	unsigned shelfHeight = 0;
+
+	atlasSize = sf::Vector2u(0, 0);
+
+	for (const auto i : order)
+	{
+		const auto size = sizes[i];
+
+		if (x > 0 && x + size.x > maxWidth)
+		{
+			y += shelfHeight + PADDING;
+			x = 0;
+			shelfHeight = 0;
+		}
+
+		rects[i] = sf::IntRect(static_cast<int>(x), static_cast<int>(y), static_cast<int>(size.x), static_cast<int>(size.y));
+
+		atlasSize.x = std::max(atlasSize.x, x + size.x);
+		atlasSize.y = std::max(atlasSize.y, y + size.y);
+		x += size.x + PADDING;
+		shelfHeight = std::max(shelfHeight, size.y);
+	}
+
+	return rects;
+}
+
+bool TextureAtlas::WriteLayout(const std::filesystem::path& path, const std::unordered_map<std::string, sf::IntRect>& textureRects)
+{
+	std::ofstream layout(path);
+
+	for (const auto& [name, rect] : textureRects)
+	{
+		layout << rect.left << ' ' << rect.top << ' ' << rect.width << ' ' << rect.height << ' ' << name << '\n';
+	}
+
+	return layout.good();
+}
+
+bool TextureAtlas::ReadLayout(const std::filesystem::path& path, std::unordered_map<std::string, sf::IntRect>& textureRects)
+{
+	std::ifstream layout(path);
+
+	if (!layout) return false;
+
+	std::string line;
+
+	textureRects.clear();
+
+	// One image per line: left top width height name
+	while (std::getline(layout, line))
+	{
+		std::istringstream stream(line);
+		sf::IntRect rect;
+		std::string name;
+
+		if (!(stream >> rect.left >> rect.top >> rect.width >> rect.height)) return false;
+
+		std::getline(stream >> std::ws, name);
+		textureRects[name] = rect;
+	}
+
+	return true;
+}
+
+bool TextureAtlas::IsCacheUpToDate(const std::filesystem::path& directory, const std::filesystem::path& cachePath)
+{
+	std::error_code error;
+	const auto imageTime = std::filesystem::last_write_time(withExtension(cachePath, ".png"), error);
+
+	if (error) return false;
+
+	const auto layoutTime = std::filesystem::last_write_time(withExtension(cachePath, ".txt"), error);
+
+	if (error) return false;
+
+	const auto cacheTime = std::min(imageTime, layoutTime);
+
+	for (const auto& path : listImages(directory, cachePath))
+	{
+		const auto time = std::filesystem::last_write_time(path, error);
+
+		if (error || time > cacheTime) return false;
+	}
+
+	return true;
+}
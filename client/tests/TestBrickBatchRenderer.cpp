@@ -0,0 +1,135 @@
+#include "Renderer/BrickBatchRenderer.h"
+#include "ClientGameData.h"
+#include "RenderInterpolation.h"
+#include "TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+using RectangleVertices = std::array<sf::Vertex, BrickBatchRenderer::VERTICES_PER_RECTANGLE>;
+
+static const sf::Vertex* GetBrickVertices(const BrickBatchRenderer& renderer, int handIndex, int brickIndex)
+{
+	const auto index = static_cast<std::size_t>(handIndex * MAX_BRICKS_PER_COLUMN + brickIndex);
+
+	// The platform is the first rectangle
+	return &renderer.GetVertices()[(index + 1) * BrickBatchRenderer::VERTICES_PER_RECTANGLE];
+}
+
+/**
+ * @brief Check if all the triangles of a rectangle are reduced to a point, so they draw nothing
+ */
+static bool IsDegenerate(const sf::Vertex* vertices)
+{
+	for (std::size_t i = 1; i < BrickBatchRenderer::VERTICES_PER_RECTANGLE; i++)
+	{
+		if (!(vertices[i].position == vertices[0].position)) return false;
+	}
+
+	return true;
+}
+
+TEST(BrickBatchRenderer, WriteRectangle)
+{
+	RectangleVertices vertices;
+
+	BrickBatchRenderer::WriteRectangle(vertices.data(), { 10.f, 20.f }, { 8.f, 4.f }, 1.f, sf::Color::White, sf::Color::Black);
+
+	// The outline covers the whole rectangle, the fill is drawn over it inside the outline
+	EXPECT_EQ(vertices[0].position, sf::Vector2f(6.f, 18.f));
+	EXPECT_EQ(vertices[4].position, sf::Vector2f(14.f, 22.f));
+	EXPECT_EQ(vertices[6].position, sf::Vector2f(7.f, 19.f));
+	EXPECT_EQ(vertices[10].position, sf::Vector2f(13.f, 21.f));
+
+	for (std::size_t i = 0; i < vertices.size(); i++)
+	{
+		EXPECT_EQ(vertices[i].color, i < vertices.size() / 2 ? sf::Color::Black : sf::Color::White);
+	}
+
+	EXPECT_FALSE(IsDegenerate(vertices.data()));
+}
+
+TEST(BrickBatchRenderer, ClearRectangle)
+{
+	RectangleVertices vertices;
+
+	BrickBatchRenderer::WriteRectangle(vertices.data(), { 10.f, 20.f }, { 8.f, 4.f }, 1.f, sf::Color::White, sf::Color::Black);
+	BrickBatchRenderer::ClearRectangle(vertices.data());
+
+	EXPECT_TRUE(IsDegenerate(vertices.data()));
+
+	for (const auto& vertex : vertices)
+	{
+		EXPECT_EQ(vertex.color.a, 0);
+	}
+}
+
+TEST(BrickBatchRenderer, StartsWithoutBricks)
+{
+	const BrickBatchRenderer renderer;
+
+	EXPECT_EQ(renderer.GetVertices().getVertexCount(), (BrickBatchRenderer::BRICK_COUNT + 1) * BrickBatchRenderer::VERTICES_PER_RECTANGLE);
+
+	for (std::size_t i = 0; i < BrickBatchRenderer::BRICK_COUNT + 1; i++)
+	{
+		EXPECT_TRUE(IsDegenerate(&renderer.GetVertices()[i * BrickBatchRenderer::VERTICES_PER_RECTANGLE]));
+	}
+}
+
+TEST(BrickBatchRenderer, OnlyChangedBricksAreRewritten)
+{
+	ClientGameData gameData;
+	gameData.StartGame(WIDTH, HEIGHT);
+
+	RenderInterpolation renderInterpolation;
+	BrickBatchRenderer renderer;
+	renderer.SetPlatform({ 350.f, 850.f }, { 600.f, 40.f });
+
+	RectangleVertices platformVertices;
+	std::copy_n(&renderer.GetVertices()[0], platformVertices.size(), platformVertices.begin());
+
+	renderInterpolation.Push(gameData);
+	renderer.Update(gameData, renderInterpolation, 1.f);
+	EXPECT_EQ(renderer.GetLastUpdatedBrickCount(), 0);
+
+	SetBrick(gameData, 0, 0, { 100.f, 100.f });
+	SetBrick(gameData, 2, 1, { 300.f, 100.f });
+	renderInterpolation.Push(gameData);
+	renderer.Update(gameData, renderInterpolation, 1.f);
+
+	EXPECT_EQ(renderer.GetLastUpdatedBrickCount(), 2);
+	EXPECT_FALSE(IsDegenerate(GetBrickVertices(renderer, 0, 0)));
+	EXPECT_FALSE(IsDegenerate(GetBrickVertices(renderer, 2, 1)));
+	EXPECT_TRUE(IsDegenerate(GetBrickVertices(renderer, 1, 0)));
+	EXPECT_EQ(GetBrickVertices(renderer, 0, 0)[0].position, sf::Vector2f(80.f, 90.f));
+
+	// Nothing moved since the last update
+	renderer.Update(gameData, renderInterpolation, 1.f);
+	EXPECT_EQ(renderer.GetLastUpdatedBrickCount(), 0);
+
+	SetBrick(gameData, 0, 0, { 100.f, 110.f });
+	renderInterpolation.Push(gameData);
+	renderer.Update(gameData, renderInterpolation, 1.f);
+
+	EXPECT_EQ(renderer.GetLastUpdatedBrickCount(), 1);
+	EXPECT_EQ(GetBrickVertices(renderer, 0, 0)[0].position, sf::Vector2f(80.f, 100.f));
+
+	// A dead brick draws nothing, once
+	gameData.BricksPerSlot[2][1].IsAlive = false;
+	renderInterpolation.Push(gameData);
+	renderer.Update(gameData, renderInterpolation, 1.f);
+
+	EXPECT_EQ(renderer.GetLastUpdatedBrickCount(), 1);
+	EXPECT_TRUE(IsDegenerate(GetBrickVertices(renderer, 2, 1)));
+
+	renderInterpolation.Push(gameData);
+	renderer.Update(gameData, renderInterpolation, 1.f);
+	EXPECT_EQ(renderer.GetLastUpdatedBrickCount(), 0);
+
+	for (std::size_t i = 0; i < platformVertices.size(); i++)
+	{
+		EXPECT_EQ(renderer.GetVertices()[i].position, platformVertices[i].position);
+	}
+}
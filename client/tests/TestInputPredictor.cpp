@@ -0,0 +1,101 @@
+#include "InputPredictor.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+constexpr PlayerInput UP = static_cast<PlayerInput>(PlayerInputTypes::Up);
+constexpr PlayerInput DOWN = static_cast<PlayerInput>(PlayerInputTypes::Down);
+constexpr PlayerInput RIGHT = static_cast<PlayerInput>(PlayerInputTypes::Right);
+constexpr PlayerInput LEFT = static_cast<PlayerInput>(PlayerInputTypes::Left);
+
+TEST(InputPredictor, RepeatLast)
+{
+	const RepeatLastInputPredictor predictor;
+	const std::vector<PlayerInput> history = { 0, LEFT, UP };
+
+	EXPECT_EQ(predictor.Predict(history, 1), UP);
+	EXPECT_EQ(predictor.Predict(history, 10), UP);
+}
+
+TEST(InputPredictor, ReleaseEdgesReleasesATap)
+{
+	const ReleaseEdgesInputPredictor predictor;
+	const std::vector<PlayerInput> history = { 0, 0, LEFT };
+
+	// Held for one frame, the tap lasts up to 3 frames
+	EXPECT_EQ(predictor.Predict(history, 1), LEFT);
+	EXPECT_EQ(predictor.Predict(history, 2), LEFT);
+	EXPECT_EQ(predictor.Predict(history, 3), 0);
+	EXPECT_EQ(predictor.Predict(history, 10), 0);
+}
+
+TEST(InputPredictor, ReleaseEdgesKeepsALongHold)
+{
+	const ReleaseEdgesInputPredictor predictor;
+	const std::vector<PlayerInput> history = { 0, LEFT, LEFT, LEFT, LEFT };
+
+	EXPECT_EQ(predictor.Predict(history, 1), LEFT);
+	EXPECT_EQ(predictor.Predict(history, 10), LEFT);
+}
+
+TEST(InputPredictor, ReleaseEdgesKeepsTheOtherKeys)
+{
+	const ReleaseEdgesInputPredictor predictor;
+	const std::vector<PlayerInput> history = { 0, static_cast<PlayerInput>(UP | DOWN) };
+
+	// Up is not an edge key, only the tap of Down ends
+	EXPECT_EQ(predictor.Predict(history, 10), UP);
+}
+
+TEST(InputPredictor, ReleaseEdgesWithAShortHistory)
+{
+	const ReleaseEdgesInputPredictor predictor;
+	const std::vector<PlayerInput> history = { RIGHT };
+
+	// The key held since the first known input is still a tap
+	EXPECT_EQ(predictor.Predict(history, 2), RIGHT);
+	EXPECT_EQ(predictor.Predict(history, 3), 0);
+}
+
+TEST(InputPredictor, PatternHit)
+{
+	const PatternInputPredictor predictor;
+	const std::vector<PlayerInput> history = { 0, LEFT, RIGHT, UP, 0, LEFT, RIGHT };
+
+	EXPECT_EQ(predictor.Predict(history, 1), UP);
+	// The next pattern is found again with the predicted input
+	EXPECT_EQ(predictor.Predict(history, 2), 0);
+	EXPECT_EQ(predictor.Predict(history, 3), LEFT);
+}
+
+TEST(InputPredictor, PatternMissRepeatsTheLastInput)
+{
+	const PatternInputPredictor predictor;
+	const std::vector<PlayerInput> history = { 0, LEFT, RIGHT, UP, DOWN };
+
+	EXPECT_EQ(predictor.Predict(history, 1), DOWN);
+	EXPECT_EQ(predictor.Predict(history, 5), DOWN);
+}
+
+TEST(InputPredictor, PatternWithAShortHistory)
+{
+	const PatternInputPredictor predictor;
+
+	EXPECT_EQ(predictor.Predict(std::vector<PlayerInput> { LEFT }, 1), LEFT);
+	EXPECT_EQ(predictor.Predict(std::vector<PlayerInput> { LEFT, RIGHT }, 3), RIGHT);
+	// As long as the pattern, it cannot be found before itself
+	EXPECT_EQ(predictor.Predict(std::vector<PlayerInput> { LEFT, RIGHT, UP }, 1), UP);
+}
+
+TEST(InputPredictor, PatternFramesAheadAreClamped)
+{
+	const PatternInputPredictor predictor(1);
+	const std::vector<PlayerInput> history = { LEFT, RIGHT, LEFT };
+
+	// Alternates from the last input, the frames past MAX_PREDICTED_FRAMES are predicted like it
+	EXPECT_EQ(predictor.Predict(history, 1), RIGHT);
+	EXPECT_EQ(predictor.Predict(history, 2), LEFT);
+	EXPECT_EQ(predictor.Predict(history, PatternInputPredictor::MAX_PREDICTED_FRAMES + 1),
+		predictor.Predict(history, PatternInputPredictor::MAX_PREDICTED_FRAMES));
+}
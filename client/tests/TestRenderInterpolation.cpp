@@ -0,0 +1,112 @@
+#include "RenderInterpolation.h"
+#include "ClientGameData.h"
+#include "TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+static void SetPlayerPosition(GameData& gameData, Math::Vec2F position)
+{
+	gameData.World.GetBody(gameData.PlayerBody).SetPosition(position);
+}
+
+class RenderInterpolationFixture : public ::testing::Test
+{
+ protected:
+	ClientGameData GameData;
+	RenderInterpolation Interpolation;
+
+	void SetUp() override
+	{
+		GameData.StartGame(WIDTH, HEIGHT);
+	}
+};
+
+TEST_F(RenderInterpolationFixture, FirstPushIsNotBlended)
+{
+	SetPlayerPosition(GameData, { 100.f, 100.f });
+	Interpolation.Push(GameData);
+
+	EXPECT_EQ(Interpolation.GetPlayerPosition(0, 0.f), Math::Vec2F(100.f, 100.f));
+	EXPECT_EQ(Interpolation.GetPlayerPosition(1, 0.f), GameData.GetGhostPosition());
+}
+
+TEST_F(RenderInterpolationFixture, PlayerIsBlended)
+{
+	SetPlayerPosition(GameData, { 100.f, 100.f });
+	Interpolation.Push(GameData);
+	SetPlayerPosition(GameData, { 120.f, 140.f });
+	Interpolation.Push(GameData);
+
+	EXPECT_EQ(Interpolation.GetPlayerPosition(0, 0.f), Math::Vec2F(100.f, 100.f));
+	EXPECT_EQ(Interpolation.GetPlayerPosition(0, 0.5f), Math::Vec2F(110.f, 120.f));
+	EXPECT_EQ(Interpolation.GetPlayerPosition(0, 1.f), Math::Vec2F(120.f, 140.f));
+}
+
+TEST_F(RenderInterpolationFixture, TeleportIsNotBlended)
+{
+	SetPlayerPosition(GameData, { 100.f, 100.f });
+	Interpolation.Push(GameData);
+	SetPlayerPosition(GameData, { 100.f, 100.f + RenderInterpolation::SNAP_DISTANCE + 1.f });
+	Interpolation.Push(GameData);
+
+	EXPECT_EQ(Interpolation.GetPlayerPosition(0, 0.f), Math::Vec2F(100.f, 100.f + RenderInterpolation::SNAP_DISTANCE + 1.f));
+}
+
+TEST_F(RenderInterpolationFixture, ResetDropsThePreviousTransforms)
+{
+	SetPlayerPosition(GameData, { 100.f, 100.f });
+	Interpolation.Push(GameData);
+	Interpolation.Reset();
+	SetPlayerPosition(GameData, { 120.f, 100.f });
+	Interpolation.Push(GameData);
+
+	EXPECT_EQ(Interpolation.GetPlayerPosition(0, 0.f), Math::Vec2F(120.f, 100.f));
+}
+
+TEST_F(RenderInterpolationFixture, BrickIsBlended)
+{
+	SetBrick(GameData, 1, 0, { 200.f, 100.f });
+	Interpolation.Push(GameData);
+	SetBrick(GameData, 1, 0, { 200.f, 110.f });
+	Interpolation.Push(GameData);
+
+	EXPECT_EQ(Interpolation.GetBrickPosition(1, 0, 0.5f), Math::Vec2F(200.f, 105.f));
+}
+
+TEST_F(RenderInterpolationFixture, SpawnedBrickIsNotBlended)
+{
+	Interpolation.Push(GameData);
+	SetBrick(GameData, 1, 0, { 200.f, 100.f });
+	Interpolation.Push(GameData);
+
+	// The slot was dead at the previous fixed update, its old position is meaningless
+	EXPECT_EQ(Interpolation.GetBrickPosition(1, 0, 0.f), Math::Vec2F(200.f, 100.f));
+}
+
+TEST_F(RenderInterpolationFixture, ReusedBrickSlotIsNotBlended)
+{
+	SetBrick(GameData, 1, 0, { 200.f, 800.f });
+	Interpolation.Push(GameData);
+
+	// The brick died and a new one took its slot at the top within the same fixed update, too far to be the same brick
+	GameData.BricksPerSlot[1][0].IsAlive = false;
+	SetBrick(GameData, 1, 0, { 200.f, 100.f });
+	Interpolation.Push(GameData);
+
+	EXPECT_EQ(Interpolation.GetBrickPosition(1, 0, 0.f), Math::Vec2F(200.f, 100.f));
+
+	// Dead at the previous fixed update, then alive again
+	GameData.BricksPerSlot[1][0].IsAlive = false;
+	Interpolation.Push(GameData);
+	SetBrick(GameData, 1, 0, { 200.f, 150.f });
+	Interpolation.Push(GameData);
+
+	EXPECT_EQ(Interpolation.GetBrickPosition(1, 0, 0.f), Math::Vec2F(200.f, 150.f));
+}
+
+TEST(RenderInterpolation, GetAlpha)
+{
+	EXPECT_FLOAT_EQ(RenderInterpolation::GetAlpha(sf::Time::Zero), 0.f);
+	EXPECT_FLOAT_EQ(RenderInterpolation::GetAlpha(sf::seconds(FIXED_TIME_STEP / 2.f)), 0.5f);
+	EXPECT_FLOAT_EQ(RenderInterpolation::GetAlpha(sf::seconds(FIXED_TIME_STEP * 3.f)), 1.f);
+}
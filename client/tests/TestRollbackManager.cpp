@@ -0,0 +1,315 @@
+#include "RollbackManager.h"
+#include "MyPackets/ConfirmationInputPacket.h"
+#include "MyPackets/PlayerInputPacket.h"
+#include "TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+
+/**
+ * @brief One client against a server that confirms its inputs a number of ticks after they are sent, with the inputs of the other player
+ * at each frame, idle by default
+ */
+class LatencyGame final : public RollbackSimulation
+{
+ public:
+	explicit LatencyGame(int latency) : _latency(latency)
+	{
+		_serverGameData.StartGame(WIDTH, HEIGHT);
+		_gameData.StartGame(WIDTH, HEIGHT);
+		Rollback.SetConfirmedGameData(_gameData, -1);
+	}
+
+	RollbackManager Rollback;
+	int IntegrityFailures = 0;
+
+	void SetGameData(const ClientGameData& gameData) override
+	{
+		_gameData = gameData;
+		_gameData.World.SetContactListener(&_gameData);
+	}
+
+	[[nodiscard]] const ClientGameData& GetGameData() const override
+	{
+		return _gameData;
+	}
+
+	void SimulateFrame(FinalInputs inputs, FinalInputs previousInputs, bool) override
+	{
+		_gameData.SetInputs(inputs.Player1Input, previousInputs.Player1Input, inputs.Player2Input, previousInputs.Player2Input);
+		_gameData.FixedUpdate();
+	}
+
+	void SetLatency(int latency)
+	{
+		_latency = latency;
+	}
+
+	void SetRemoteInputs(PlayerInput (*remoteInputs)(int frame))
+	{
+		_remoteInputs = remoteInputs;
+	}
+
+ private:
+	struct SentInputs
+	{
+		int Tick;
+		std::vector<PlayerInputPerFrame> Inputs;
+	};
+
+	int _latency;
+	int _tick = 0;
+	PlayerInput (*_remoteInputs)(int frame) = nullptr;
+	std::deque<SentInputs> _sentInputs;
+
+	ClientGameData _serverGameData;
+	std::vector<PlayerInput> _serverInputs;
+	std::vector<PlayerInput> _serverRemoteInputs;
+	std::vector<Checksum> _serverChecksums;
+
+	ClientGameData _gameData;
+
+	void confirm(const std::vector<PlayerInputPerFrame>& inputs)
+	{
+		for (const auto& input : inputs)
+		{
+			if (input.Frame != static_cast<int>(_serverInputs.size())) continue;
+
+			const auto previousInput = _serverInputs.empty() ? PlayerInput {} : _serverInputs.back();
+			const auto previousRemoteInput = _serverRemoteInputs.empty() ? PlayerInput {} : _serverRemoteInputs.back();
+			const auto remoteInput = _remoteInputs == nullptr ? PlayerInput {} : _remoteInputs(input.Frame);
+
+			_serverInputs.push_back(input.Input);
+			_serverRemoteInputs.push_back(remoteInput);
+			_serverGameData.SetInputs(input.Input, previousInput, remoteInput, previousRemoteInput);
+			_serverGameData.FixedUpdate();
+			_serverChecksums.push_back(_serverGameData.GenerateChecksum());
+
+			MyPackets::ConfirmInputPacket packet(input.Input, remoteInput, _serverChecksums.back());
+			Rollback.OnPacketReceived(packet);
+		}
+	}
+
+ public:
+	void Tick(PlayerInput input)
+	{
+		_tick++;
+
+		Rollback.AddPlayerInputs(input);
+		_sentInputs.push_back({ _tick, Rollback.GetLastLocalPlayerInputs() });
+
+		while (!_sentInputs.empty() && _sentInputs.front().Tick + _latency <= _tick)
+		{
+			confirm(_sentInputs.front().Inputs);
+			_sentInputs.pop_front();
+		}
+
+		// Like the fixed update of the Application
+		Rollback.SimulateFrames(*this);
+
+		const auto confirmedFrame = Rollback.GetConfirmedFrame() - 1;
+
+		if (confirmedFrame < 0) return;
+
+		if (!(Rollback.GetConfirmedGameData().GenerateChecksum() == _serverChecksums[confirmedFrame])) IntegrityFailures++;
+	}
+};
+
+/**
+ * @brief Idle long enough for the input delay to settle, then jump and move from side to side
+ */
+static PlayerInput GetInput(int tick)
+{
+	if (tick < 3 * PHYSICAL_FRAME_RATE) return 0;
+
+	const auto side = (tick / 7) % 2 == 0 ? PlayerInputTypes::Left : PlayerInputTypes::Right;
+	const auto jump = tick % 20 == 0 ? static_cast<PlayerInput>(PlayerInputTypes::Up) : PlayerInput {};
+
+	return static_cast<PlayerInput>(static_cast<PlayerInput>(side) | jump);
+}
+
+TEST(RollbackManager, ConfirmationsBeforeSimulationAtOneTickLatency)
+{
+	LatencyGame game(1);
+
+	for (int tick = 0; tick < 10 * PHYSICAL_FRAME_RATE; tick++)
+	{
+		game.Tick(GetInput(tick));
+	}
+
+	// The input delay hides the whole latency, the frames are confirmed before they are simulated
+	EXPECT_EQ(game.Rollback.GetInputDelay(), 1);
+	EXPECT_EQ(game.IntegrityFailures, 0);
+	EXPECT_EQ(game.Rollback.GetConfirmedFrame(), game.Rollback.GetConfirmedInputFrame());
+	EXPECT_EQ(game.Rollback.GetConfirmedFrame(), game.Rollback.GetCurrentFrame() + 1);
+	EXPECT_EQ(game.Rollback.GetRollbackCount(), 0u);
+}
+
+TEST(RollbackManager, ConfirmationsAfterSimulation)
+{
+	LatencyGame game(6);
+
+	for (int tick = 0; tick < 10 * PHYSICAL_FRAME_RATE; tick++)
+	{
+		game.Tick(GetInput(tick));
+	}
+
+	EXPECT_EQ(game.Rollback.GetInputDelay(), 3);
+	EXPECT_EQ(game.IntegrityFailures, 0);
+	EXPECT_LT(game.Rollback.GetConfirmedFrame(), game.Rollback.GetCurrentFrame());
+}
+
+/**
+ * @brief Count the presses of a key in the local inputs known for the frames, confirmed or not
+ */
+static int CountPresses(RollbackManager& rollback, PlayerInputTypes key)
+{
+	auto presses = 0;
+	auto frameCount = static_cast<int>(rollback.GetConfirmedInputFrame());
+	const auto localInputs = rollback.GetLastLocalPlayerInputs();
+
+	if (!localInputs.empty()) frameCount = localInputs.back().Frame + 1;
+
+	for (int frame = 0; frame < frameCount; frame++)
+	{
+		const auto input = rollback.GetPlayerInput(PlayerNumber::PLAYER1, frame);
+
+		if (IsKeyPressed(input, key) && !IsKeyPressed(rollback.GetPlayerInput(PlayerNumber::PLAYER1, frame - 1), key)) presses++;
+	}
+
+	return presses;
+}
+
+TEST(RollbackManager, InputReadDuringStallIsKept)
+{
+	RollbackManager rollback;
+	rollback.SetMaxInputDelay(0);
+
+	for (int i = 0; i < MAX_PREDICTION_FRAMES; i++)
+	{
+		rollback.AddPlayerInputs(0);
+	}
+
+	const auto currentFrame = rollback.GetCurrentFrame();
+
+	rollback.AddPlayerInputs(static_cast<PlayerInput>(PlayerInputTypes::Up));
+
+	EXPECT_EQ(rollback.GetStallCount(), 1u);
+	EXPECT_EQ(rollback.GetCurrentFrame(), currentFrame);
+
+	MyPackets::ConfirmInputPacket packet(0, 0, {});
+	rollback.OnPacketReceived(packet);
+	rollback.AddPlayerInputs(0);
+
+	EXPECT_EQ(rollback.GetCurrentFrame(), currentFrame + 1);
+	EXPECT_TRUE(IsKeyPressed(rollback.GetPlayerInput(PlayerNumber::PLAYER1, currentFrame + 1), PlayerInputTypes::Up));
+
+	rollback.OnPacketReceived(packet);
+	rollback.AddPlayerInputs(0);
+
+	EXPECT_FALSE(IsKeyPressed(rollback.GetPlayerInput(PlayerNumber::PLAYER1, currentFrame + 2), PlayerInputTypes::Up));
+}
+
+TEST(RollbackManager, NoPressIsLostWhenTheInputDelayChanges)
+{
+	LatencyGame game(MAX_PREDICTION_FRAMES + 6);
+	auto taps = 0;
+
+	const auto tick = [&game, &taps](int tickIndex)
+	{
+		const auto isTap = tickIndex % 10 == 0;
+		if (isTap) taps++;
+		game.Tick(isTap ? static_cast<PlayerInput>(PlayerInputTypes::Up) : PlayerInput {});
+	};
+
+	// Past the prediction window, the client stalls while the input delay grows
+	for (int tickIndex = 0; tickIndex < 5 * PHYSICAL_FRAME_RATE; tickIndex++)
+	{
+		tick(tickIndex);
+	}
+
+	EXPECT_GT(game.Rollback.GetStallCount(), 0u);
+	EXPECT_EQ(game.Rollback.GetInputDelay(), MAX_INPUT_DELAY);
+
+	game.SetLatency(1);
+
+	for (int tickIndex = 0; tickIndex < 10 * PHYSICAL_FRAME_RATE; tickIndex++)
+	{
+		tick(tickIndex);
+	}
+
+	EXPECT_EQ(game.Rollback.GetInputDelay(), 1);
+	EXPECT_EQ(CountPresses(game.Rollback, PlayerInputTypes::Up), taps);
+	EXPECT_EQ(game.IntegrityFailures, 0);
+}
+
+TEST(RollbackManager, EveryMispredictedInputOfAPacketIsCounted)
+{
+	RollbackManager rollback;
+	rollback.SetMaxInputDelay(0);
+	rollback.AddPlayerInputs(0);
+
+	MyPackets::ConfirmInputPacket confirmation(0, 0, {});
+	rollback.OnPacketReceived(confirmation);
+
+	for (int i = 0; i < 4; i++)
+	{
+		rollback.AddPlayerInputs(0);
+	}
+
+	ASSERT_EQ(rollback.GetCurrentFrame(), 4);
+
+	// The frames were simulated without the key, the earlier inputs of the packet do not make the later ones predicted
+	const auto left = static_cast<PlayerInput>(PlayerInputTypes::Left);
+	MyPackets::PlayerInputPacket packet({ { 1, left }, { 2, left }, { 3, left } }, 3, 0);
+	rollback.OnPacketReceived(packet);
+
+	EXPECT_EQ(rollback.GetInputPredictionStatistics().Predictions, 4u);
+	EXPECT_EQ(rollback.GetInputPredictionStatistics().Mispredictions, 3u);
+	EXPECT_TRUE(rollback.NeedToRollback());
+}
+
+TEST(RollbackManager, IrrelevantMispredictionSkipsTheRollback)
+{
+	LatencyGame game(6);
+
+	// The ghost does nothing with Up, the other player taps it after the players are unfrozen
+	game.SetRemoteInputs([](int frame)
+	{
+		return frame >= 3 * PHYSICAL_FRAME_RATE && frame % 20 == 0 ? static_cast<PlayerInput>(PlayerInputTypes::Up) : PlayerInput {};
+	});
+
+	for (int tick = 0; tick < 10 * PHYSICAL_FRAME_RATE; tick++)
+	{
+		game.Tick(0);
+	}
+
+	EXPECT_GT(game.Rollback.GetInputPredictionStatistics().Mispredictions, 0u);
+	EXPECT_GT(game.Rollback.GetSkippedRollbackCount(), 0u);
+	EXPECT_EQ(game.Rollback.GetRollbackCount(), 0u);
+	EXPECT_EQ(game.IntegrityFailures, 0);
+}
+
+TEST(RollbackManager, RelevantMispredictionRollsBack)
+{
+	LatencyGame game(6);
+
+	// The ghost moves one slot to the right, then back to the left
+	game.SetRemoteInputs([](int frame)
+	{
+		if (frame < 3 * PHYSICAL_FRAME_RATE) return PlayerInput {};
+		if (frame % 40 == 0) return static_cast<PlayerInput>(PlayerInputTypes::Right);
+		if (frame % 40 == 20) return static_cast<PlayerInput>(PlayerInputTypes::Left);
+
+		return PlayerInput {};
+	});
+
+	for (int tick = 0; tick < 10 * PHYSICAL_FRAME_RATE; tick++)
+	{
+		game.Tick(0);
+	}
+
+	EXPECT_GT(game.Rollback.GetRollbackCount(), 0u);
+	EXPECT_EQ(game.IntegrityFailures, 0);
+}
@@ -0,0 +1,88 @@
+#include "Renderer/TextLayoutCache.h"
+
+#include <gtest/gtest.h>
+
+static int layoutCount = 0;
+
+/**
+ * @brief Lay out a string without a font, one quad per character
+ */
+static TextLayout FakeLayout(const std::string& string, unsigned characterSize, sf::Text::Style style)
+{
+	layoutCount++;
+
+	TextLayout layout;
+	layout.CharacterSize = characterSize;
+	layout.Vertices.resize(string.size() * 6);
+	layout.Bounds = sf::FloatRect(0.f, 0.f, static_cast<float>(string.size() * characterSize), static_cast<float>((style & sf::Text::Style::Bold) != 0 ? 2 : 1));
+
+	return layout;
+}
+
+class TextLayoutCacheFixture : public ::testing::Test
+{
+ protected:
+	void SetUp() override
+	{
+		TextLayoutCache::Clear();
+		layoutCount = 0;
+	}
+
+	void TearDown() override
+	{
+		TextLayoutCache::Clear();
+	}
+};
+
+TEST_F(TextLayoutCacheFixture, StringIsLaidOutOnce)
+{
+	const auto& layout = TextLayoutCache::Get("Score: 10", 24, sf::Text::Style::Regular, FakeLayout);
+	const auto& cachedLayout = TextLayoutCache::Get("Score: 10", 24, sf::Text::Style::Regular, FakeLayout);
+
+	EXPECT_EQ(&layout, &cachedLayout);
+	EXPECT_EQ(layoutCount, 1);
+	EXPECT_EQ(layout.Vertices.size(), 9u * 6u);
+	EXPECT_EQ(layout.CharacterSize, 24u);
+	EXPECT_EQ(TextLayoutCache::GetSize(), 1u);
+}
+
+TEST_F(TextLayoutCacheFixture, SizeAndStyleAreLaidOutApart)
+{
+	const auto& layout = TextLayoutCache::Get("Play", 24, sf::Text::Style::Regular, FakeLayout);
+	const auto& biggerLayout = TextLayoutCache::Get("Play", 32, sf::Text::Style::Regular, FakeLayout);
+	const auto& boldLayout = TextLayoutCache::Get("Play", 24, sf::Text::Style::Bold, FakeLayout);
+	const auto& otherLayout = TextLayoutCache::Get("Quit", 24, sf::Text::Style::Regular, FakeLayout);
+
+	EXPECT_EQ(layoutCount, 4);
+	EXPECT_EQ(TextLayoutCache::GetSize(), 4u);
+	EXPECT_EQ(biggerLayout.CharacterSize, 32u);
+	EXPECT_EQ(boldLayout.Bounds.height, 2.f);
+	EXPECT_NE(&layout, &otherLayout);
+
+	// The references stay valid while other strings are added
+	EXPECT_EQ(&TextLayoutCache::Get("Play", 24, sf::Text::Style::Regular, FakeLayout), &layout);
+	EXPECT_EQ(layoutCount, 4);
+}
+
+TEST_F(TextLayoutCacheFixture, ClearInvalidatesTheLayouts)
+{
+	TextLayoutCache::Get("Play", 24, sf::Text::Style::Regular, FakeLayout);
+	TextLayoutCache::Get("Quit", 24, sf::Text::Style::Regular, FakeLayout);
+
+	TextLayoutCache::Clear();
+
+	EXPECT_EQ(TextLayoutCache::GetSize(), 0u);
+
+	TextLayoutCache::Get("Play", 24, sf::Text::Style::Regular, FakeLayout);
+
+	EXPECT_EQ(layoutCount, 3);
+	EXPECT_EQ(TextLayoutCache::GetSize(), 1u);
+}
+
+TEST_F(TextLayoutCacheFixture, EmptyWithoutAssets)
+{
+	const auto& layout = TextLayoutCache::Get("Play", 24, sf::Text::Style::Regular);
+
+	EXPECT_TRUE(layout.Vertices.empty());
+	EXPECT_EQ(TextLayoutCache::GetSize(), 0u);
+}
@@ -0,0 +1,142 @@
+#include "TextureAtlas.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+
+/**
+ * @brief Empty directory in the temporary directory, removed with its content at the end of the test
+ */
+class TemporaryDirectory
+{
+ public:
+	explicit TemporaryDirectory(const std::string& name) : Path(std::filesystem::temp_directory_path() / name)
+	{
+		std::filesystem::remove_all(Path);
+		std::filesystem::create_directories(Path);
+	}
+
+	~TemporaryDirectory()
+	{
+		std::error_code error;
+		std::filesystem::remove_all(Path, error);
+	}
+
+	const std::filesystem::path Path;
+};
+
+static void WriteFile(const std::filesystem::path& path)
+{
+	std::filesystem::create_directories(path.parent_path());
+	std::ofstream(path) << "content";
+}
+
+static void SetTime(const std::filesystem::path& path, std::filesystem::file_time_type time)
+{
+	std::filesystem::last_write_time(path, time);
+}
+
+TEST(TextureAtlas, PackPlacesTallestFirstOnShelves)
+{
+	sf::Vector2u atlasSize;
+	const auto rects = TextureAtlas::Pack({ { 10, 5 }, { 10, 20 }, { 10, 10 } }, 64, atlasSize);
+
+	ASSERT_EQ(rects.size(), 3u);
+	// Same order as the sizes, placed from the tallest with PADDING between them
+	EXPECT_EQ(rects[1], sf::IntRect(0, 0, 10, 20));
+	EXPECT_EQ(rects[2], sf::IntRect(10 + TextureAtlas::PADDING, 0, 10, 10));
+	EXPECT_EQ(rects[0], sf::IntRect(2 * (10 + TextureAtlas::PADDING), 0, 10, 5));
+	EXPECT_EQ(atlasSize, sf::Vector2u(30 + 2 * TextureAtlas::PADDING, 20));
+}
+
+TEST(TextureAtlas, PackStartsAShelfWhenFull)
+{
+	sf::Vector2u atlasSize;
+	const auto rects = TextureAtlas::Pack({ { 30, 10 }, { 30, 8 }, { 30, 6 } }, 64, atlasSize);
+
+	EXPECT_EQ(rects[0], sf::IntRect(0, 0, 30, 10));
+	EXPECT_EQ(rects[1], sf::IntRect(30 + TextureAtlas::PADDING, 0, 30, 8));
+	// The shelf is as tall as its tallest image
+	EXPECT_EQ(rects[2], sf::IntRect(0, 10 + TextureAtlas::PADDING, 30, 6));
+	EXPECT_EQ(atlasSize, sf::Vector2u(60 + TextureAtlas::PADDING, 16 + TextureAtlas::PADDING));
+}
+
+TEST(TextureAtlas, PackGivesWideImagesTheirOwnShelf)
+{
+	sf::Vector2u atlasSize;
+	const auto rects = TextureAtlas::Pack({ { 100, 10 }, { 10, 5 } }, 64, atlasSize);
+
+	EXPECT_EQ(rects[0], sf::IntRect(0, 0, 100, 10));
+	EXPECT_EQ(rects[1], sf::IntRect(0, 10 + TextureAtlas::PADDING, 10, 5));
+	EXPECT_EQ(atlasSize, sf::Vector2u(100, 15 + TextureAtlas::PADDING));
+}
+
+TEST(TextureAtlas, PackWithoutImages)
+{
+	sf::Vector2u atlasSize(1, 1);
+	const auto rects = TextureAtlas::Pack({}, 64, atlasSize);
+
+	EXPECT_TRUE(rects.empty());
+	EXPECT_EQ(atlasSize, sf::Vector2u(0, 0));
+}
+
+TEST(TextureAtlas, LayoutRoundTrip)
+{
+	const TemporaryDirectory directory("TestTextureAtlasLayout");
+	const std::unordered_map<std::string, sf::IntRect> textureRects = {
+		{ "player/idle_0", { 0, 0, 32, 48 } },
+		{ "ui/play button", { 33, 0, 120, 40 } },
+		{ "brick", { 0, 49, 40, 20 } }
+	};
+
+	ASSERT_TRUE(TextureAtlas::WriteLayout(directory.Path / "atlas.txt", textureRects));
+
+	std::unordered_map<std::string, sf::IntRect> readRects = { { "stale", { 1, 2, 3, 4 } } };
+
+	ASSERT_TRUE(TextureAtlas::ReadLayout(directory.Path / "atlas.txt", readRects));
+	EXPECT_EQ(readRects, textureRects);
+}
+
+TEST(TextureAtlas, ReadLayoutRejectsMissingOrMalformedFiles)
+{
+	const TemporaryDirectory directory("TestTextureAtlasMalformed");
+	std::unordered_map<std::string, sf::IntRect> textureRects;
+
+	EXPECT_FALSE(TextureAtlas::ReadLayout(directory.Path / "missing.txt", textureRects));
+
+	std::ofstream(directory.Path / "malformed.txt") << "0 0 wide 10 brick\n";
+
+	EXPECT_FALSE(TextureAtlas::ReadLayout(directory.Path / "malformed.txt", textureRects));
+}
+
+TEST(TextureAtlas, CacheIsUpToDateOnlyWhenNewerThanTheImages)
+{
+	const TemporaryDirectory directory("TestTextureAtlasCache");
+	const auto images = directory.Path / "images";
+	const auto cachePath = directory.Path / "atlas";
+	const auto now = std::filesystem::file_time_type::clock::now();
+
+	WriteFile(images / "brick.png");
+	WriteFile(images / "player" / "idle_0.png");
+	SetTime(images / "brick.png", now - std::chrono::hours(2));
+	SetTime(images / "player" / "idle_0.png", now - std::chrono::hours(2));
+
+	EXPECT_FALSE(TextureAtlas::IsCacheUpToDate(images, cachePath));
+
+	WriteFile(directory.Path / "atlas.png");
+
+	// The image of the cache without its layout
+	EXPECT_FALSE(TextureAtlas::IsCacheUpToDate(images, cachePath));
+
+	WriteFile(directory.Path / "atlas.txt");
+	SetTime(directory.Path / "atlas.png", now - std::chrono::hours(1));
+	SetTime(directory.Path / "atlas.txt", now - std::chrono::hours(1));
+
+	EXPECT_TRUE(TextureAtlas::IsCacheUpToDate(images, cachePath));
+
+	// An image of a subdirectory edited after the cache was written
+	SetTime(images / "player" / "idle_0.png", now);
+
+	EXPECT_FALSE(TextureAtlas::IsCacheUpToDate(images, cachePath));
+}
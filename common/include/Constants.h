@@ -106,4 +106,21 @@ enum class PlayerRole
 };
 
 constexpr int PHYSICAL_FRAME_RATE = 30;
-constexpr float FIXED_TIME_STEP = 1.f / PHYSICAL_FRAME_RATE;
\ No newline at end of file
+constexpr float FIXED_TIME_STEP = 1.f / PHYSICAL_FRAME_RATE;
+/**
+ * Most frames a local input is delayed by, so it reaches the other player before it simulates that frame, 0 to apply the inputs at once
+ */
+constexpr int MAX_INPUT_DELAY = 3;
+/**
+ * Most frames simulated ahead of the last confirmed one, the client waits for the confirmations past it, which bounds the rollbacks
+ */
+constexpr int MAX_PREDICTION_FRAMES = 8;
+/**
+ * Most share of FIXED_TIME_STEP a fixed update is stretched or shortened by, to bring the frames of the two clients together
+ */
+constexpr float MAX_TIME_SYNC_STRETCH = 0.05f;
+
+/**
+ * Seconds between two exports of the profiler to files, read by the Prometheus textfile collector or any JSON tool
+ */
+constexpr float PROFILER_EXPORT_INTERVAL = 10.f;
@@ -96,6 +96,13 @@ public:
 	void SwitchPlayerAndGhost();
 
 	[[nodiscard]] Math::Vec2F GetGhostPosition() const;
+	/**
+	 * @brief Keys of a role that can change the game at the next FixedUpdate, a change of the other keys has no effect,
+	 * like the brick key during the cooldown or any key while the players are frozen
+	 * @param role Role of the player pressing the keys
+	 * @param asPreviousInput True for the keys of the previous input, which only matter for the keys triggered by a press
+	 */
+	[[nodiscard]] PlayerInput GetRelevantInputs(PlayerRole role, bool asPreviousInput) const;
 
 	/**
 	 * @brief Compare two GameData, players drawable are not compared
@@ -12,9 +12,18 @@ namespace MyPackets
 	{
 	public:
 		PlayerInputPacket() : Packet(static_cast<char>(MyPacketType::PlayerInput)) {}
-		explicit PlayerInputPacket(std::vector<PlayerInputPerFrame> playerInputs) : Packet(static_cast<char>(MyPacketType::PlayerInput)), LastInputs(std::move(playerInputs)) {}
+		explicit PlayerInputPacket(std::vector<PlayerInputPerFrame> playerInputs, short currentFrame, sf::Int8 frameAdvantage) :
+			Packet(static_cast<char>(MyPacketType::PlayerInput)), LastInputs(std::move(playerInputs)), CurrentFrame(currentFrame), FrameAdvantage(frameAdvantage) {}
 
 		std::vector<PlayerInputPerFrame> LastInputs {};
+		/**
+		 * @brief Frame simulated by the sender when it sent the inputs
+		 */
+		short CurrentFrame = 0;
+		/**
+		 * @brief Frames the sender is ahead of the receiver, from the last CurrentFrame of the receiver it got
+		 */
+		sf::Int8 FrameAdvantage = 0;
 
 		[[nodiscard]] Packet* Clone() const override { return new PlayerInputPacket(*this); }
 		[[nodiscard]] std::string ToString() const override { return "PlayerInputPacket"; }
@@ -28,6 +37,8 @@ namespace MyPackets
 				packet << static_cast<sf::Uint8>(input.Input);
 				packet << input.Frame;
 			}
+
+			packet << CurrentFrame << FrameAdvantage;
 		}
 
 		void Read(sf::Packet& packet) override
@@ -45,6 +56,8 @@ namespace MyPackets
 
 				packet >> input.Frame;
 			}
+
+			packet >> CurrentFrame >> FrameAdvantage;
 		}
 	};
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "GameData.h"
 
 #include "Constants.h"
+#include "Profiler.h"
 
 #include <bit>
 
@@ -50,6 +51,8 @@ void GameData::SetupWorld()
 	player.SetUseGravity(true);
 	player.SetBodyType(Physics::BodyType::Dynamic);
 	player.SetPosition(PlayerPosition);
+	// Only swept when a step moves it more than half its size, keeps it on the platform with a lower physical frame rate
+	player.SetIsBullet(true);
 
 	playerCollider.SetIsTrigger(false);
 	playerCollider.SetRectangle({
@@ -96,6 +99,8 @@ void GameData::IncreaseGhostSlot()
 
 void GameData::FixedUpdate()
 {
+	PROFILE_SCOPE(fixedUpdateProfile, "GameData::FixedUpdate");
+
 	sf::Time elapsed = sf::seconds(FIXED_TIME_STEP);
 
 	if (BrickCooldown > 0.f)
@@ -285,6 +290,37 @@ Math::Vec2F GameData::GetGhostPosition() const
 	return {x * _width, HAND_START_POSITION.Y * _height};
 }
 
+PlayerInput GameData::GetRelevantInputs(PlayerRole role, bool asPreviousInput) const
+{
+	if (FreezePlayersForFrames > 0) return {};
+
+	constexpr auto up = static_cast<PlayerInput>(PlayerInputTypes::Up);
+	constexpr auto down = static_cast<PlayerInput>(PlayerInputTypes::Down);
+	constexpr auto left = static_cast<PlayerInput>(PlayerInputTypes::Left);
+	constexpr auto right = static_cast<PlayerInput>(PlayerInputTypes::Right);
+
+	PlayerInput relevantInputs {};
+
+	if (role == PlayerRole::PLAYER)
+	{
+		// Only the jump is triggered by a press, the moves use the key held
+		if (IsPlayerOnGround) relevantInputs |= up;
+		if (!asPreviousInput) relevantInputs |= left | right;
+
+		return relevantInputs;
+	}
+
+	// The ghost reacts to the presses only, the current and the previous inputs matter the same
+	// Moving left from the first slot does nothing, even when moving right in the same frame as it is done after
+	if (Ghost != GhostSlot::SLOT_1) relevantInputs |= left;
+	relevantInputs |= right;
+
+	// Same operation as the cooldown decrease of FixedUpdate, done before the ghost update
+	if (BrickCooldown - sf::seconds(FIXED_TIME_STEP).asSeconds() <= 0.f) relevantInputs |= down;
+
+	return relevantInputs;
+}
+
 bool GameData::operator==(const GameData& other) const
 {
 	return PlayerPosition == other.PlayerPosition && Ghost == other.Ghost;
@@ -0,0 +1,137 @@
+#include "GameData.h"
+#include "TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+constexpr auto UP = static_cast<PlayerInput>(PlayerInputTypes::Up);
+
+/**
+ * @brief The first player is the player and the second one the ghost, the roles are never switched
+ */
+class TestGameData final : public GameData
+{
+ public:
+	void SetInputs(PlayerInput player1Input, PlayerInput player1PreviousInput, PlayerInput player2Input, PlayerInput player2PreviousInput) override
+	{
+		_playerInputs = player1Input;
+		_previousPlayerInputs = player1PreviousInput;
+		_ghostInputs = player2Input;
+		_previousGhostInputs = player2PreviousInput;
+	}
+
+	void OnSwitchPlayerAndGhost() override {}
+
+	void Update(PlayerInput playerInput, PlayerInput previousPlayerInput)
+	{
+		SetInputs(playerInput, previousPlayerInput, 0, 0);
+		FixedUpdate();
+	}
+};
+
+TEST(GameData, PlayerLandsOnPlatform)
+{
+	TestGameData gameData;
+	gameData.StartGame(WIDTH, HEIGHT);
+
+	for (int i = 0; i < 10; i++)
+	{
+		gameData.Update(0, 0);
+	}
+
+	EXPECT_TRUE(gameData.IsPlayerOnGround);
+	EXPECT_FALSE(gameData.IsPlayerDead);
+}
+
+TEST(GameData, PlayerJumpsAfterStandingIdle)
+{
+	TestGameData gameData;
+	gameData.StartGame(WIDTH, HEIGHT);
+
+	// Long enough for a resting body to be put to sleep
+	for (int i = 0; i < 60; i++)
+	{
+		gameData.Update(0, 0);
+	}
+
+	ASSERT_TRUE(gameData.IsPlayerOnGround);
+
+	const auto groundY = gameData.PlayerPosition.Y;
+
+	gameData.Update(UP, 0);
+
+	for (int i = 0; i < 5; i++)
+	{
+		gameData.Update(UP, UP);
+	}
+
+	EXPECT_LT(gameData.PlayerPosition.Y, groundY);
+	EXPECT_FALSE(gameData.IsPlayerOnGround);
+}
+
+TEST(GameData, NoInputIsRelevantWhileFrozen)
+{
+	TestGameData gameData;
+	gameData.StartGame(WIDTH, HEIGHT);
+	gameData.FreezePlayersForFrames = 1;
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::PLAYER, false), 0);
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, false), 0);
+}
+
+TEST(GameData, PlayerJumpIsRelevantOnlyOnGround)
+{
+	TestGameData gameData;
+	gameData.StartGame(WIDTH, HEIGHT);
+	gameData.IsPlayerOnGround = true;
+
+	const auto moves = static_cast<PlayerInput>(static_cast<PlayerInput>(PlayerInputTypes::Left) | static_cast<PlayerInput>(PlayerInputTypes::Right));
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::PLAYER, false), UP | moves);
+	// The moves use the key held, only the previous input of the jump matters
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::PLAYER, true), UP);
+
+	gameData.IsPlayerOnGround = false;
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::PLAYER, false), moves);
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::PLAYER, true), 0);
+}
+
+TEST(GameData, GhostLeftIsNotRelevantInTheFirstSlot)
+{
+	TestGameData gameData;
+	gameData.StartGame(WIDTH, HEIGHT);
+	const auto left = static_cast<PlayerInput>(PlayerInputTypes::Left);
+	const auto right = static_cast<PlayerInput>(PlayerInputTypes::Right);
+
+	gameData.Ghost = GhostSlot::SLOT_2;
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, false) & (left | right), left | right);
+
+	gameData.Ghost = GhostSlot::SLOT_1;
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, false) & (left | right), right);
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, true) & (left | right), right);
+}
+
+TEST(GameData, GhostDownIsRelevantOnceTheCooldownExpires)
+{
+	TestGameData gameData;
+	gameData.StartGame(WIDTH, HEIGHT);
+	const auto down = static_cast<PlayerInput>(PlayerInputTypes::Down);
+	// The fixed time step as the fixed update counts it
+	const auto elapsed = sf::seconds(FIXED_TIME_STEP).asSeconds();
+
+	gameData.BrickCooldown = 2.f * elapsed;
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, false) & down, 0);
+
+	// The cooldown expires during the next fixed update, before the ghost reads its inputs
+	gameData.BrickCooldown = elapsed;
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, false) & down, down);
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, true) & down, down);
+
+	gameData.BrickCooldown = 0.f;
+
+	EXPECT_EQ(gameData.GetRelevantInputs(PlayerRole::GHOST, false) & down, down);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "GameData.h"
+
+/**
+ * Game data helpers shared by the tests of the common and the client parts.
+ */
+
+inline constexpr ScreenSizeValue HEIGHT = { 900.f };
+inline constexpr ScreenSizeValue WIDTH = { 700.f };
+
+/**
+ * @brief Make a brick slot alive with its collider at a position, like a brick spawned by the ghost then moved by the world
+ */
+inline void SetBrick(GameData& gameData, int handIndex, int brickIndex, Math::Vec2F position)
+{
+	auto& brick = gameData.BricksPerSlot[handIndex][brickIndex];
+
+	if (!brick.IsAlive)
+	{
+		brick.Body = gameData.World.CreateBody();
+		brick.Collider = gameData.World.CreateCollider(brick.Body);
+		brick.IsAlive = true;
+		gameData.World.GetCollider(brick.Collider).SetRectangle({ { -20.f, -10.f }, { 20.f, 10.f } });
+	}
+
+	gameData.World.GetCollider(brick.Collider).SetPosition(position);
+}
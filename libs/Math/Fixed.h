@@ -0,0 +1,219 @@
+#pragma once
+
+/**
+ * @headerfile Fixed point numbers, computed with integers only so every build and platform gives the same results.
+ * A standalone number type, usable with Vec2<T>: the physics engine is not templated on it and still simulates in float,
+ * kept deterministic by the DETERMINISTIC_FLOAT_OPTIONS of the simulation targets.
+ */
+
+#include "Exception.h"
+#include "TrigoLUT.h"
+
+#include <compare>
+#include <concepts>
+#include <cstdint>
+
+namespace Math
+{
+    /**
+     * @brief A number with a fixed number of bits after the point.
+     * The arithmetic is done on integers, so the results do not depend on the compiler flags (-O3, -ffast-math, FMA) or the platform
+     * @tparam FractionBits The number of bits after the point
+     * @tparam Storage The signed integer holding the value
+     * @tparam Intermediate A signed integer twice as large as the storage, used by the multiplication and the division
+     */
+    template<int FractionBits, typename Storage, typename Intermediate>
+    class Fixed
+    {
+    public:
+        constexpr Fixed() noexcept = default;
+
+        template<std::integral I>
+        constexpr Fixed(I value) noexcept : _raw(static_cast<Storage>(static_cast<Storage>(value) << FractionBits)) {}
+
+        /**
+         * @brief Round a floating point number to the nearest fixed point number.
+         * The conversion is exact for the same input, but the input has to come from a deterministic source (a constant, a file)
+         */
+        constexpr explicit Fixed(double value) noexcept :
+            _raw(static_cast<Storage>(value * static_cast<double>(One) + (value < 0 ? -0.5 : 0.5))) {}
+        constexpr explicit Fixed(float value) noexcept : Fixed(static_cast<double>(value)) {}
+
+    private:
+        static constexpr Storage One = static_cast<Storage>(1) << FractionBits;
+
+        Storage _raw { 0 };
+
+    public:
+        [[nodiscard]] constexpr static Fixed FromRaw(Storage raw) noexcept
+        {
+            Fixed fixed;
+            fixed._raw = raw;
+
+            return fixed;
+        }
+
+        [[nodiscard]] constexpr Storage Raw() const noexcept { return _raw; }
+
+        /**
+         * @brief The biggest integer lower or equal to the value
+         */
+        [[nodiscard]] constexpr Storage Floor() const noexcept { return _raw >> FractionBits; }
+
+        [[nodiscard]] constexpr explicit operator float() const noexcept
+        {
+            return static_cast<float>(static_cast<double>(_raw) / static_cast<double>(One));
+        }
+
+        [[nodiscard]] constexpr explicit operator double() const noexcept
+        {
+            return static_cast<double>(_raw) / static_cast<double>(One);
+        }
+
+#pragma region Operators
+
+        [[nodiscard]] constexpr friend Fixed operator+(Fixed a, Fixed b) noexcept
+        {
+            return FromRaw(static_cast<Storage>(a._raw + b._raw));
+        }
+
+        [[nodiscard]] constexpr friend Fixed operator-(Fixed a, Fixed b) noexcept
+        {
+            return FromRaw(static_cast<Storage>(a._raw - b._raw));
+        }
+
+        [[nodiscard]] constexpr Fixed operator-() const noexcept
+        {
+            return FromRaw(static_cast<Storage>(-_raw));
+        }
+
+        [[nodiscard]] constexpr friend Fixed operator*(Fixed a, Fixed b) noexcept
+        {
+            // The shift rounds toward minus infinity, the same way on every platform
+            return FromRaw(static_cast<Storage>(static_cast<Intermediate>(a._raw) * b._raw >> FractionBits));
+        }
+
+        [[nodiscard]] constexpr friend Fixed operator/(Fixed a, Fixed b)
+        {
+            if (b._raw == 0)
+            {
+                throw DivisionByZeroException();
+            }
+
+            return FromRaw(static_cast<Storage>((static_cast<Intermediate>(a._raw) << FractionBits) / b._raw));
+        }
+
+        /**
+         * @brief Remainder of the division, with the sign of the dividend like fmod
+         */
+        [[nodiscard]] constexpr friend Fixed operator%(Fixed a, Fixed b)
+        {
+            if (b._raw == 0)
+            {
+                throw DivisionByZeroException();
+            }
+
+            return FromRaw(static_cast<Storage>(a._raw % b._raw));
+        }
+
+        constexpr Fixed& operator+=(Fixed fixed) noexcept { return *this = *this + fixed; }
+        constexpr Fixed& operator-=(Fixed fixed) noexcept { return *this = *this - fixed; }
+        constexpr Fixed& operator*=(Fixed fixed) noexcept { return *this = *this * fixed; }
+        constexpr Fixed& operator/=(Fixed fixed) { return *this = *this / fixed; }
+
+        constexpr friend bool operator==(Fixed a, Fixed b) noexcept = default;
+        constexpr friend auto operator<=>(Fixed a, Fixed b) noexcept = default;
+
+#pragma endregion
+    };
+
+    /**
+     * @brief 16 bits for the integer part (-32768 to 32767) and 16 bits for the fraction (1/65536)
+     */
+    using Fixed16 = Fixed<16, std::int32_t, std::int64_t>;
+#ifdef __SIZEOF_INT128__
+    /**
+     * @brief 32 bits for the integer part and 32 bits for the fraction, needs a 128 bits integer for the multiplication.
+     * Only with GCC and Clang, MSVC has no 128 bits integer
+     */
+    using Fixed32 = Fixed<32, std::int64_t, __int128>;
+#endif
+
+    /**
+     * @brief Square root computed digit by digit on the integers, exact to the last bit of the fraction
+     * @return 0 for negative values
+     */
+    template<int FractionBits, typename Storage, typename Intermediate>
+    [[nodiscard]] constexpr Fixed<FractionBits, Storage, Intermediate> Sqrt(Fixed<FractionBits, Storage, Intermediate> value) noexcept
+    {
+        if (value.Raw() <= 0) return 0;
+
+        // sqrt(raw / one) * one = sqrt(raw * one)
+        auto remainder = static_cast<Intermediate>(value.Raw()) << FractionBits;
+        Intermediate root = 0;
+        auto bit = static_cast<Intermediate>(1) << (sizeof(Intermediate) * 8 - 2);
+
+        while (bit > remainder)
+        {
+            bit >>= 2;
+        }
+
+        while (bit != 0)
+        {
+            if (remainder >= root + bit)
+            {
+                remainder -= root + bit;
+                root = (root >> 1) + bit;
+            }
+            else
+            {
+                root >>= 1;
+            }
+
+            bit >>= 2;
+        }
+
+        return Fixed<FractionBits, Storage, Intermediate>::FromRaw(static_cast<Storage>(root));
+    }
+
+    /**
+     * @brief Interpolate a periodic look up table over a full turn
+     */
+    template<int FractionBits, typename Storage, typename Intermediate>
+    [[nodiscard]] constexpr Fixed<FractionBits, Storage, Intermediate> CalculateFixedLut(Fixed<FractionBits, Storage, Intermediate> radian,
+        const std::array<float, Size>& table) noexcept
+    {
+        using FixedT = Fixed<FractionBits, Storage, Intermediate>;
+
+        constexpr FixedT twoPi(6.28318530717958647692);
+
+        auto angle = radian % twoPi;
+
+        if (angle < 0)
+        {
+            angle += twoPi;
+        }
+
+        const auto position = angle * FixedT(static_cast<int>(Size)) / twoPi;
+        const auto index = static_cast<std::size_t>(position.Floor()) % Size;
+        const auto ratio = position - FixedT(position.Floor());
+
+        // The values of the table are exact in the fixed point, so they convert the same way everywhere
+        const FixedT indexValue(table[index]);
+        const FixedT nextValue(table[(index + 1) % Size]);
+
+        return indexValue + (nextValue - indexValue) * ratio;
+    }
+
+    template<int FractionBits, typename Storage, typename Intermediate>
+    [[nodiscard]] constexpr Fixed<FractionBits, Storage, Intermediate> Sin(Fixed<FractionBits, Storage, Intermediate> radian) noexcept
+    {
+        return CalculateFixedLut(radian, SinLUT);
+    }
+
+    template<int FractionBits, typename Storage, typename Intermediate>
+    [[nodiscard]] constexpr Fixed<FractionBits, Storage, Intermediate> Cos(Fixed<FractionBits, Storage, Intermediate> radian) noexcept
+    {
+        return CalculateFixedLut(radian, CosLUT);
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Intrinsics.h"
+#include "Shape.h"
+
+#include <cstdint>
+
+namespace Math
+{
+    /**
+     * @brief Rectangles stored as a structure of arrays, so one rectangle can be tested against several others at once
+     * @note The arrays are not owned, they must contain at least BatchSize readable values after the first rectangle tested
+     */
+    struct RectanglesSoA
+    {
+        const float* MinX { nullptr };
+        const float* MinY { nullptr };
+        const float* MaxX { nullptr };
+        const float* MaxY { nullptr };
+    };
+
+#if defined(__AVX__)
+    inline constexpr std::size_t IntersectBatchSize = 8;
+#elif defined(__SSE__)
+    inline constexpr std::size_t IntersectBatchSize = 4;
+#else
+    inline constexpr std::size_t IntersectBatchSize = 1;
+#endif
+
+    /**
+     * @brief Test a rectangle against IntersectBatchSize rectangles, gives the same result as Intersect(rectangle, rectangles[i])
+     * @param rectangle The rectangle to test
+     * @param rectangles The rectangles to test against
+     * @param index The index of the first rectangle to test in the arrays
+     * @return A mask where the bit i is set if the rectangle intersects the rectangle index + i
+     */
+    [[nodiscard]] inline std::uint32_t IntersectMask(const RectangleF& rectangle, const RectanglesSoA& rectangles, std::size_t index) noexcept
+    {
+        const auto minBound = rectangle.MinBound();
+        const auto maxBound = rectangle.MaxBound();
+
+#if defined(__AVX__)
+        const __m256 minX = _mm256_loadu_ps(rectangles.MinX + index);
+        const __m256 minY = _mm256_loadu_ps(rectangles.MinY + index);
+        const __m256 maxX = _mm256_loadu_ps(rectangles.MaxX + index);
+        const __m256 maxY = _mm256_loadu_ps(rectangles.MaxY + index);
+
+        // Not less than / not greater than, to keep the same result as the scalar version with NaN
+        const __m256 overlapX = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_set1_ps(maxBound.X), minX, _CMP_NLT_UQ),
+            _mm256_cmp_ps(_mm256_set1_ps(minBound.X), maxX, _CMP_NGT_UQ));
+        const __m256 overlapY = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_set1_ps(maxBound.Y), minY, _CMP_NLT_UQ),
+            _mm256_cmp_ps(_mm256_set1_ps(minBound.Y), maxY, _CMP_NGT_UQ));
+
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_and_ps(overlapX, overlapY)));
+#elif defined(__SSE__)
+        const __m128 minX = _mm_loadu_ps(rectangles.MinX + index);
+        const __m128 minY = _mm_loadu_ps(rectangles.MinY + index);
+        const __m128 maxX = _mm_loadu_ps(rectangles.MaxX + index);
+        const __m128 maxY = _mm_loadu_ps(rectangles.MaxY + index);
+
+        // Not less than / not greater than, to keep the same result as the scalar version with NaN
+        const __m128 overlapX = _mm_and_ps(
+            _mm_cmpnlt_ps(_mm_set1_ps(maxBound.X), minX),
+            _mm_cmpngt_ps(_mm_set1_ps(minBound.X), maxX));
+        const __m128 overlapY = _mm_and_ps(
+            _mm_cmpnlt_ps(_mm_set1_ps(maxBound.Y), minY),
+            _mm_cmpngt_ps(_mm_set1_ps(minBound.Y), maxY));
+
+        return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_and_ps(overlapX, overlapY)));
+#else
+        if (maxBound.X < rectangles.MinX[index] || minBound.X > rectangles.MaxX[index]) return 0;
+        if (maxBound.Y < rectangles.MinY[index] || minBound.Y > rectangles.MaxY[index]) return 0;
+
+        return 1;
+#endif
+    }
+}
@@ -37,6 +37,8 @@ namespace Math
             }
         }
 
+        constexpr NVec2(const std::array<T, N> xs, const std::array<T, N> ys) noexcept : _x(xs), _y(ys) {}
+
     private:
         std::array<T, N> _x = std::array<T, N>();
         std::array<T, N> _y = std::array<T, N>();
@@ -219,6 +221,22 @@ namespace Math
             return *this;
         }
 
+        /**
+         * @brief Component-wise minimum, same as std::min(nV1, nV2) for each component
+         */
+        [[nodiscard]] static NVec2<T, N> Min(const NVec2<T, N>& nV1, const NVec2<T, N>& nV2) noexcept
+        {
+            NVec2<T, N> result = NVec2<T, N>();
+
+            for (int i = 0; i < N; i++)
+            {
+                result._x[i] = nV2._x[i] < nV1._x[i] ? nV2._x[i] : nV1._x[i];
+                result._y[i] = nV2._y[i] < nV1._y[i] ? nV2._y[i] : nV1._y[i];
+            }
+
+            return result;
+        }
+
         static std::array<T, N> Dot(const NVec2<T, N>& nV1, const NVec2<T, N>& nV2) noexcept
         {
             std::array<T, N> result = std::array<T, N>();
@@ -410,6 +428,60 @@ namespace Math
         return *this;
     }
 
+    template<>
+    [[nodiscard]] NOALIAS inline FourVec2F FourVec2F::operator*(const std::array<float, 4> array1N) const noexcept
+    {
+        FourVec2F result = FourVec2F();
+
+        __m128 x1 = _mm_loadu_ps(_x.data());
+        __m128 y1 = _mm_loadu_ps(_y.data());
+        __m128 scalars = _mm_loadu_ps(array1N.data());
+
+        __m128 x1Scalars = _mm_mul_ps(x1, scalars);
+        __m128 y1Scalars = _mm_mul_ps(y1, scalars);
+
+        _mm_storeu_ps(result._x.data(), x1Scalars);
+        _mm_storeu_ps(result._y.data(), y1Scalars);
+
+        return result;
+    }
+
+    template<>
+    inline FourVec2F& FourVec2F::operator*=(const std::array<float, 4> array1N) noexcept
+    {
+        __m128 x1 = _mm_loadu_ps(_x.data());
+        __m128 y1 = _mm_loadu_ps(_y.data());
+        __m128 scalars = _mm_loadu_ps(array1N.data());
+
+        __m128 x1Scalars = _mm_mul_ps(x1, scalars);
+        __m128 y1Scalars = _mm_mul_ps(y1, scalars);
+
+        _mm_storeu_ps(_x.data(), x1Scalars);
+        _mm_storeu_ps(_y.data(), y1Scalars);
+
+        return *this;
+    }
+
+    template<>
+    [[nodiscard]] inline FourVec2F FourVec2F::Min(const FourVec2F& nV1, const FourVec2F& nV2) noexcept
+    {
+        FourVec2F result = FourVec2F();
+
+        __m128 x1 = _mm_loadu_ps(nV1._x.data());
+        __m128 x2 = _mm_loadu_ps(nV2._x.data());
+        __m128 y1 = _mm_loadu_ps(nV1._y.data());
+        __m128 y2 = _mm_loadu_ps(nV2._y.data());
+
+        // _mm_min_ps returns its second operand when one is NaN, swap them to behave like std::min
+        __m128 minX = _mm_min_ps(x2, x1);
+        __m128 minY = _mm_min_ps(y2, y1);
+
+        _mm_storeu_ps(result._x.data(), minX);
+        _mm_storeu_ps(result._y.data(), minY);
+
+        return result;
+    }
+
     template<>
     [[nodiscard]] inline FourVec2F FourVec2F::operator/(const FourVec2F& nVec2) const
     {
@@ -2,7 +2,10 @@
 
 #include "Vec2.h"
 
-#include <vector>
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <span>
 
 namespace Math
 {
@@ -147,31 +150,53 @@ namespace Math
     class Polygon
     {
     public:
+        /**
+         * @brief Maximum number of vertices of a polygon, the vertices are stored inline so copying a polygon never allocates
+         */
+        static constexpr std::size_t MaxVerticesCount = 8;
+
+        /**
+         * @brief Construct a new Polygon object
+         * @param vertices the vertices of the polygon
+         * @throw OutOfRangeException if there are more than MaxVerticesCount vertices
+         */
+        constexpr explicit Polygon(std::initializer_list<Vec2<T>> vertices) { SetVertices(std::span<const Vec2<T>>(vertices.begin(), vertices.size())); }
         /**
          * @brief Construct a new Polygon object
          * @param vertices the vertices of the polygon
+         * @throw OutOfRangeException if there are more than MaxVerticesCount vertices
          */
-        constexpr explicit Polygon(std::vector<Vec2<T>> vertices) noexcept : _vertices(vertices) {}
+        constexpr explicit Polygon(std::span<const Vec2<T>> vertices) { SetVertices(vertices); }
 
     private:
-        std::vector<Vec2<T>> _vertices;
+        std::array<Vec2<T>, MaxVerticesCount> _vertices {};
+        std::size_t _verticesCount = 0;
 
     public:
-        [[nodiscard]] constexpr std::vector<Vec2<T>> Vertices() const noexcept { return _vertices; }
-        [[nodiscard]] constexpr int VerticesCount() const noexcept { return _vertices.size(); }
+        [[nodiscard]] constexpr std::span<const Vec2<T>> Vertices() const noexcept { return { _vertices.data(), _verticesCount }; }
+        [[nodiscard]] constexpr int VerticesCount() const noexcept { return static_cast<int>(_verticesCount); }
 
-        void SetVertices(std::vector<Vec2<T>> vertices) noexcept { _vertices = vertices; }
+        constexpr void SetVertices(std::span<const Vec2<T>> vertices)
+        {
+            if (vertices.size() > MaxVerticesCount)
+            {
+                throw OutOfRangeException();
+            }
+
+            std::copy(vertices.begin(), vertices.end(), _vertices.begin());
+            _verticesCount = vertices.size();
+        }
 
         [[nodiscard]] constexpr Vec2<T> Center() const noexcept
         {
             Vec2<T> center = Vec2<T>::Zero();
 
-            for (const auto& vertex : _vertices)
+            for (const auto& vertex : Vertices())
             {
                 center += vertex;
             }
 
-            return center / _vertices.size();
+            return center / _verticesCount;
         }
 
         [[nodiscard]] constexpr Vec2<T> Size() const noexcept
@@ -179,7 +204,7 @@ namespace Math
             Vec2<T> minBound = Vec2<T>::Zero();
             Vec2<T> maxBound = Vec2<T>::Zero();
 
-            for (const auto& vertex : _vertices)
+            for (const auto& vertex : Vertices())
             {
                 minBound.X = Math::Min(minBound.X, vertex.X);
                 minBound.Y = Math::Min(minBound.Y, vertex.Y);
@@ -193,14 +218,14 @@ namespace Math
 		
 		[[nodiscard]] constexpr Polygon<T> operator+(const Vec2<T>& vec) const noexcept
 	    {
-		    std::vector<Vec2<T>> vertices = _vertices;
+		    Polygon<T> polygon = *this;
 
-		    for (auto& vertex : vertices)
+		    for (std::size_t i = 0; i < _verticesCount; i++)
 		    {
-			    vertex += vec;
+			    polygon._vertices[i] += vec;
 		    }
 
-		    return Polygon<T>(vertices);
+		    return polygon;
 	    }
     };
 
@@ -272,72 +297,80 @@ namespace Math
     {
         return Intersect(rectangle, circle);
     }
-
+    /**
+     * @brief Project translated vertices on an axis
+     * @param vertices the vertices to project, must not be empty
+     * @param translation the translation applied to every vertex
+     * @param axis the axis to project on
+     * @return the minimum projection in X and the maximum projection in Y
+     */
     template <typename T>
-    [[nodiscard]] constexpr bool Intersect(const Polygon<T> polygon1, const Polygon<T> polygon2) noexcept
+    [[nodiscard]] constexpr Vec2<T> Project(std::span<const Vec2<T>> vertices, Vec2<T> translation, Vec2<T> axis) noexcept
     {
-        // Separate axis theorem
-        // Check if any of the edges of polygon1 is a separating axis
-        for (int i = 0, j = polygon1.VerticesCount() - 1; i < polygon1.VerticesCount(); j = i++)
-        {
-            const auto edge = polygon1.Vertices()[i] - polygon1.Vertices()[j];
-            const auto normal = Vec2<T>(-edge.Y, edge.X);
-
-            const auto startProjection1 = polygon1.Vertices()[0].Dot(normal);
-            const auto startProjection2 = polygon2.Vertices()[0].Dot(normal);
-
-            Vec2<T> projection1 = Vec2<T>(startProjection1, startProjection1);
-            Vec2<T> projection2 = Vec2<T>(startProjection2, startProjection2);
-
-            for (const auto& vertex : polygon1.Vertices())
-            {
-                const auto projection = vertex.Dot(normal);
-
-                projection1 = Vec2<T>(Math::Min(projection1.X, projection), Math::Max(projection1.Y, projection));
-            }
+        const T offset = translation.Dot(axis);
+        T min = vertices[0].Dot(axis);
+        T max = min;
 
-            for (const auto& vertex : polygon2.Vertices())
-            {
-                const auto projection = vertex.Dot(normal);
-
-                projection2 = Vec2<T>(Math::Min(projection2.X, projection), Math::Max(projection2.Y, projection));
-            }
+        for (std::size_t i = 1; i < vertices.size(); i++)
+        {
+            const auto projection = vertices[i].Dot(axis);
 
-            if (projection1.Y < projection2.X || projection2.Y < projection1.X) return false;
+            min = Math::Min(min, projection);
+            max = Math::Max(max, projection);
         }
 
-        // Check if any of the edges of polygon2 is a separating axis
-        for (int i = 0, j = polygon2.VerticesCount() - 1; i < polygon2.VerticesCount(); j = i++)
+        return Vec2<T>(min + offset, max + offset);
+    }
+
+    /**
+     * @brief Check if one of the edges of the first polygon is a separating axis between the two polygons
+     * @return true if an edge of the first polygon separates them
+     */
+    template <typename T>
+    [[nodiscard]] constexpr bool HasSeparatingAxis(std::span<const Vec2<T>> vertices1, Vec2<T> translation1,
+        std::span<const Vec2<T>> vertices2, Vec2<T> translation2) noexcept
+    {
+        for (std::size_t i = 0, j = vertices1.size() - 1; i < vertices1.size(); j = i++)
         {
-            const auto edge = polygon2.Vertices()[i] - polygon2.Vertices()[j];
+            const auto edge = vertices1[i] - vertices1[j];
             const auto normal = Vec2<T>(-edge.Y, edge.X);
 
-            const auto startProjection1 = polygon1.Vertices()[0].Dot(normal);
-            const auto startProjection2 = polygon2.Vertices()[0].Dot(normal);
-
-            Vec2<T> projection1 = Vec2<T>(startProjection1, startProjection1);
-            Vec2<T> projection2 = Vec2<T>(startProjection2, startProjection2);
-
-            for (const auto& vertex : polygon1.Vertices())
-            {
-                const auto projection = vertex.Dot(normal);
+            const auto projection1 = Project(vertices1, translation1, normal);
+            const auto projection2 = Project(vertices2, translation2, normal);
 
-                projection1 = Vec2<T>(Math::Min(projection1.X, projection), Math::Max(projection1.Y, projection));
-            }
+            if (projection1.Y < projection2.X || projection2.Y < projection1.X) return true;
+        }
 
-            for (const auto& vertex : polygon2.Vertices())
-            {
-                const auto projection = vertex.Dot(normal);
+        return false;
+    }
 
-                projection2 = Vec2<T>(Math::Min(projection2.X, projection), Math::Max(projection2.Y, projection));
-            }
+    /**
+     * @brief Check if two polygons intersect, the vertices are translated on the fly so nothing is copied
+     * @param vertices1 the vertices of the first polygon
+     * @param translation1 the translation of the first polygon
+     * @param vertices2 the vertices of the second polygon
+     * @param translation2 the translation of the second polygon
+     * @return true if the polygons intersect
+     */
+    template <typename T>
+    [[nodiscard]] constexpr bool Intersect(std::span<const Vec2<T>> vertices1, Vec2<T> translation1,
+        std::span<const Vec2<T>> vertices2, Vec2<T> translation2) noexcept
+    {
+        if (vertices1.empty() || vertices2.empty()) return false;
 
-            if (projection1.Y < projection2.X || projection2.Y < projection1.X) return false;
-        }
+        // Separate axis theorem
+        if (HasSeparatingAxis(vertices1, translation1, vertices2, translation2)) return false;
+        if (HasSeparatingAxis(vertices2, translation2, vertices1, translation1)) return false;
 
         return true;
     }
 
+    template <typename T>
+    [[nodiscard]] constexpr bool Intersect(const Polygon<T>& polygon1, const Polygon<T>& polygon2) noexcept
+    {
+        return Intersect(polygon1.Vertices(), Vec2<T>::Zero(), polygon2.Vertices(), Vec2<T>::Zero());
+    }
+
     template<typename T>
     Vec2<T> ClosestPointOnSegment(const Vec2<T> &A, const Vec2<T> &B, const Vec2<T> &P)
     {
@@ -355,24 +388,32 @@ namespace Math
         }
     }
 
+    /**
+     * @brief Check if a polygon and a circle intersect, the vertices are translated on the fly so nothing is copied
+     * @param vertices the vertices of the polygon
+     * @param translation the translation of the polygon
+     * @param circle the circle
+     * @return true if the polygon and the circle intersect
+     */
     template <typename T>
-    [[nodiscard]] constexpr bool Intersect(const Polygon<T> polygon, const Circle<T> circle) noexcept
+    [[nodiscard]] constexpr bool Intersect(std::span<const Vec2<T>> vertices, Vec2<T> translation, const Circle<T> circle) noexcept
     {
-        const auto center = circle.Center();
+        // Move the circle instead of the polygon
+        const auto center = circle.Center() - translation;
         const auto radius = circle.Radius();
 
-        for (const auto &vertex: polygon.Vertices())
+        for (const auto &vertex: vertices)
         {
-            if (circle.Contains(vertex))
+            if ((center - vertex).SquareLength() <= radius * radius)
             {
                 return true;
             }
         }
 
-        for (int i = 0, j = polygon.VerticesCount() - 1; i < polygon.VerticesCount(); j = i++)
+        for (std::size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
         {
-            const auto p1 = polygon.Vertices()[i];
-            const auto p2 = polygon.Vertices()[j];
+            const auto p1 = vertices[i];
+            const auto p2 = vertices[j];
 
             // Calculate the closest point on the edge to the circle's center.
             Vec2<T> closest = ClosestPointOnSegment(p1, p2, center);
@@ -388,27 +429,46 @@ namespace Math
     }
 
     template <typename T>
-    [[nodiscard]] constexpr bool Intersect(const Circle<T> circle, const Polygon<T> polygon) noexcept
+    [[nodiscard]] constexpr bool Intersect(const Polygon<T>& polygon, const Circle<T> circle) noexcept
+    {
+        return Intersect(polygon.Vertices(), Vec2<T>::Zero(), circle);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr bool Intersect(const Circle<T> circle, const Polygon<T>& polygon) noexcept
     {
         return Intersect(polygon, circle);
     }
 
+    /**
+     * @brief Check if a polygon and a rectangle intersect, the vertices are translated on the fly so nothing is copied
+     * @param vertices the vertices of the polygon
+     * @param translation the translation of the polygon
+     * @param rectangle the rectangle
+     * @return true if the polygon and the rectangle intersect
+     */
     template <typename T>
-    [[nodiscard]] constexpr bool Intersect(const Polygon<T> polygon, const Rectangle<T> rectangle) noexcept
+    [[nodiscard]] constexpr bool Intersect(std::span<const Vec2<T>> vertices, Vec2<T> translation, const Rectangle<T> rectangle) noexcept
     {
-        Polygon<T> rectToPolygon = Polygon<T>({
+        const std::array<Vec2<T>, 4> rectangleVertices = {
             rectangle.MinBound(),
             Vec2<T>(rectangle.MinBound().X, rectangle.MaxBound().Y),
             rectangle.MaxBound(),
             Vec2<T>(rectangle.MaxBound().X, rectangle.MinBound().Y)
-        });
+        };
 
-        return Intersect(polygon, rectToPolygon);
+        return Intersect(vertices, translation, std::span<const Vec2<T>>(rectangleVertices), Vec2<T>::Zero());
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr bool Intersect(const Polygon<T>& polygon, const Rectangle<T> rectangle) noexcept
+    {
+        return Intersect(polygon.Vertices(), Vec2<T>::Zero(), rectangle);
     }
 
     template <typename T>
-    [[nodiscard]] constexpr bool Intersect(const Rectangle<T> rectangle, const Polygon<T> polygon) noexcept
+    [[nodiscard]] constexpr bool Intersect(const Rectangle<T> rectangle, const Polygon<T>& polygon) noexcept
     {
         return Intersect(polygon, rectangle);
     }
-}
\ No newline at end of file
+}
@@ -199,7 +199,15 @@ namespace Math
         template<typename U = T>
         [[nodiscard]] NOALIAS U Length() const noexcept
         {
-            return static_cast<U>(std::sqrt(X * X + Y * Y));
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                return static_cast<U>(std::sqrt(X * X + Y * Y));
+            }
+            else
+            {
+                // Number types like Fixed bring their own square root
+                return static_cast<U>(Sqrt(X * X + Y * Y));
+            }
         }
 
         template<typename U = T>
@@ -0,0 +1,49 @@
+#include "Allocator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+namespace
+{
+	HeapAllocator heapAllocator;
+	ThreadCacheAllocator threadCacheAllocator(heapAllocator, MemoryTag::Network);
+
+	/**
+	 * @brief Allocate and deallocate blocks of a few sizes, like the packets and queue chunks of the network threads
+	 */
+	void allocateBlocks(benchmark::State& state, Allocator& allocator)
+	{
+		constexpr std::array<std::size_t, 4> sizes = { 24, 64, 200, 512 };
+		std::array<void*, 32> ptrs {};
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < ptrs.size(); i++)
+			{
+				ptrs[i] = allocator.Allocate(sizes[i % sizes.size()], 8);
+			}
+
+			benchmark::DoNotOptimize(ptrs);
+
+			for (auto* ptr : ptrs)
+			{
+				allocator.Deallocate(ptr);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ptrs.size()));
+	}
+}
+
+static void BM_HeapAllocator(benchmark::State& state)
+{
+	allocateBlocks(state, heapAllocator);
+}
+BENCHMARK(BM_HeapAllocator)->Threads(1)->Threads(4);
+
+static void BM_ThreadCacheAllocator(benchmark::State& state)
+{
+	allocateBlocks(state, threadCacheAllocator);
+}
+BENCHMARK(BM_ThreadCacheAllocator)->Threads(1)->Threads(4);
@@ -0,0 +1,51 @@
+#include "Profiler.h"
+#include "World.h"
+
+#include <benchmark/benchmark.h>
+
+/**
+ * @brief Cost of a profiled scope, enabled (1) or disabled (0)
+ */
+static void BM_ProfileScope(benchmark::State& state)
+{
+	Profiler::SetEnabled(state.range(0) != 0);
+
+	for (auto _ : state)
+	{
+		PROFILE_SCOPE(scope, "Bench::scope");
+		benchmark::ClobberMemory();
+	}
+
+	Profiler::SetEnabled(true);
+}
+BENCHMARK(BM_ProfileScope)->Arg(0)->Arg(1);
+
+/**
+ * @brief A world of falling boxes updated with the profiler disabled (0) or enabled (1), the difference is the overhead of the zones
+ */
+static void BM_WorldProfiler(benchmark::State& state)
+{
+	Physics::World world;
+	world.SetGravity(Math::Vec2F(0.f, 800.f));
+	world.SetSleepThreshold(0.f, 0);
+
+	for (int i = 0; i < 200; i++)
+	{
+		const auto bodyRef = world.CreateBody();
+		auto& body = world.GetBody(bodyRef);
+
+		body.SetPosition(Math::Vec2F(static_cast<float>(i % 20) * 60.f, static_cast<float>(i / 20) * -60.f));
+		body.SetUseGravity(true);
+		world.GetCollider(world.CreateCollider(bodyRef)).SetRectangle(Math::RectangleF(Math::Vec2F(-25.f, -25.f), Math::Vec2F(25.f, 25.f)));
+	}
+
+	Profiler::SetEnabled(state.range(0) != 0);
+
+	for (auto _ : state)
+	{
+		world.Update(1.f / 30.f);
+	}
+
+	Profiler::SetEnabled(true);
+}
+BENCHMARK(BM_WorldProfiler)->Arg(0)->Arg(1);
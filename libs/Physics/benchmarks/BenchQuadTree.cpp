@@ -0,0 +1,86 @@
+#include "QuadTree.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace
+{
+	const Math::RectangleF Boundary(Math::Vec2F(0.f, 0.f), Math::Vec2F(1'000.f, 1'000.f));
+
+	std::vector<Physics::SimplifiedCollider> generateColliders(std::size_t count) noexcept
+	{
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(0.f, 990.f);
+		std::uniform_real_distribution<float> size(1.f, 10.f);
+
+		std::vector<Physics::SimplifiedCollider> colliders;
+		colliders.reserve(count);
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const Math::Vec2F minBound(position(generator), position(generator));
+			colliders.push_back({{i, 0}, Math::RectangleF(minBound, minBound + Math::Vec2F(size(generator), size(generator)))});
+		}
+
+		return colliders;
+	}
+}
+
+/**
+ * @brief Rebuild the quadtree and compute all the possible pairs, as done by the world every step
+ */
+static void BM_QuadTreeStep(benchmark::State& state)
+{
+	const auto depth = static_cast<std::size_t>(state.range(0));
+	const auto colliders = generateColliders(static_cast<std::size_t>(state.range(1)));
+
+	Physics::QuadTree quadTree(Boundary, depth);
+
+	for (auto _ : state)
+	{
+		quadTree.ClearColliders();
+
+		for (const auto& collider : colliders)
+		{
+			quadTree.Insert(collider);
+		}
+
+		benchmark::DoNotOptimize(quadTree.GetAllPossiblePairs().size());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * colliders.size()));
+}
+BENCHMARK(BM_QuadTreeStep)->ArgsProduct({{1, 2, 3, 4, 5, 6}, {100, 1'000, 5'000}})->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Query a filled quadtree with colliders that are not in it, as done for dynamic colliders against the static quadtree
+ */
+static void BM_QuadTreeQuery(benchmark::State& state)
+{
+	const auto depth = static_cast<std::size_t>(state.range(0));
+	const auto colliders = generateColliders(static_cast<std::size_t>(state.range(1)));
+
+	Physics::QuadTree quadTree(Boundary, depth);
+
+	for (const auto& collider : colliders)
+	{
+		quadTree.Insert(collider);
+	}
+
+	HeapAllocator allocator;
+	MyVector<Physics::ColliderPair> pairs { StandardAllocator<Physics::ColliderPair> {allocator} };
+
+	for (auto _ : state)
+	{
+		pairs.clear();
+
+		for (std::size_t i = 0; i < 100; i++)
+		{
+			quadTree.AddPossiblePairs({{colliders.size() + i, 0}, colliders[i].Bounds}, pairs);
+		}
+
+		benchmark::DoNotOptimize(pairs.size());
+	}
+}
+BENCHMARK(BM_QuadTreeQuery)->ArgsProduct({{1, 2, 3, 4, 5, 6}, {1'000, 5'000}})->Unit(benchmark::kMicrosecond);
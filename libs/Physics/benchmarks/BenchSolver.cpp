@@ -0,0 +1,71 @@
+#include "World.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Columns of boxes of the same mass on a static ground, with the resolver (0 iterations) or the solver.
+ * Reports how much the top boxes still move once the stacks had time to settle
+ */
+static void BM_WorldStack(benchmark::State& state)
+{
+	static constexpr std::size_t ColumnCount = 20;
+	static constexpr float DeltaTime = 1.f / 30.f;
+
+	const auto boxCount = static_cast<std::size_t>(state.range(0));
+	const auto iterations = static_cast<std::size_t>(state.range(1));
+
+	Physics::World world;
+	world.SetGravity(Math::Vec2F(0.f, 800.f));
+	world.SetSleepThreshold(0.f, 0);
+	world.SetSolverIterations(iterations);
+
+	const auto groundRef = world.CreateBody();
+	world.GetBody(groundRef).SetBodyType(Physics::BodyType::Static);
+	world.GetCollider(world.CreateCollider(groundRef)).SetRectangle(Math::RectangleF(Math::Vec2F(-100.f, 0.f), Math::Vec2F(100.f * ColumnCount, 50.f)));
+
+	std::vector<Physics::BodyRef> topBoxes;
+
+	for (std::size_t column = 0; column < ColumnCount; column++)
+	{
+		for (std::size_t i = 0; i < boxCount; i++)
+		{
+			const auto bodyRef = world.CreateBody();
+			auto& body = world.GetBody(bodyRef);
+
+			body.SetPosition(Math::Vec2F(100.f * static_cast<float>(column), -25.f - 51.f * static_cast<float>(i)));
+			body.SetMass(1.f);
+			body.SetUseGravity(true);
+			world.GetCollider(world.CreateCollider(bodyRef)).SetRectangle(Math::RectangleF(Math::Vec2F(-25.f, -25.f), Math::Vec2F(25.f, 25.f)));
+
+			if (i == boxCount - 1) topBoxes.push_back(bodyRef);
+		}
+	}
+
+	// Let the stacks settle before measuring
+	for (int i = 0; i < 120; i++)
+	{
+		world.Update(DeltaTime);
+	}
+
+	float maxTopSpeed = 0.f;
+
+	for (auto _ : state)
+	{
+		world.Update(DeltaTime);
+		benchmark::ClobberMemory();
+
+		state.PauseTiming();
+		for (const auto& topBox : topBoxes)
+		{
+			maxTopSpeed = std::max(maxTopSpeed, world.GetBody(topBox).Velocity().Length());
+		}
+		state.ResumeTiming();
+	}
+
+	state.counters["MaxTopSpeed"] = maxTopSpeed;
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ColumnCount * boxCount));
+}
+BENCHMARK(BM_WorldStack)->ArgsProduct({ { 5, 10 }, { 0, 4, 8 } })->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,41 @@
+#include "World.h"
+
+#include <benchmark/benchmark.h>
+
+/**
+ * @brief Integrate dynamic bodies without colliders, mixed with some static and kinematic bodies
+ */
+static void BM_WorldUpdateBodies(benchmark::State& state)
+{
+	const auto bodyCount = static_cast<std::size_t>(state.range(0));
+
+	// Only the bodies grow with the world, keeps the collider loops out of the measure
+	Physics::World world(1);
+	world.SetGravity(Math::Vec2F(0.f, 9.81f));
+
+	for (std::size_t i = 0; i < bodyCount; i++)
+	{
+		auto& body = world.GetBody(world.CreateBody());
+
+		body.SetPosition(Math::Vec2F(static_cast<float>(i % 100), static_cast<float>(i / 100)));
+
+		if (i % 10 == 0)
+		{
+			body.SetBodyType(i % 20 == 0 ? Physics::BodyType::Static : Physics::BodyType::Kinematic);
+			continue;
+		}
+
+		body.SetMass(1.f + static_cast<float>(i % 7));
+		body.SetUseGravity(i % 3 != 0);
+		body.SetVelocity(Math::Vec2F(1.f, -1.f));
+	}
+
+	for (auto _ : state)
+	{
+		world.Update(1.f / 30.f);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * bodyCount));
+}
+BENCHMARK(BM_WorldUpdateBodies)->Arg(1'000)->Arg(10'000)->Unit(benchmark::kMicrosecond);
@@ -4,6 +4,8 @@
 
 #include "Vec2.h"
 
+#include <cstdint>
+
 namespace Physics
 {
     /**
@@ -21,6 +23,9 @@ namespace Physics
 		Body(Math::Vec2F position, Math::Vec2F velocity) noexcept;
 
 	private:
+		// The world gathers the bodies directly in a structure of arrays to integrate them
+		friend class World;
+
 		Math::Vec2F _position = Math::Vec2F(0, 0);
 		Math::Vec2F _velocity = Math::Vec2F(0, 0);
 		Math::Vec2F _force = Math::Vec2F(0, 0);
@@ -28,6 +33,11 @@ namespace Physics
 		float _inverseMass = 0.f;
         BodyType _bodyType = BodyType::Dynamic;
         bool _useGravity { false };
+		// Swept against the static colliders when it moves, so it cannot go through them
+		bool _isBullet { false };
+		// Number of consecutive steps the body has been slower than the sleep velocity
+		std::uint32_t _restFrames { 0 };
+		bool _isAwake { true };
 
 	public:
         /**
@@ -65,6 +75,11 @@ namespace Physics
          * @return The use gravity of the body
          */
         [[nodiscard]] bool UseGravity() const noexcept;
+		/**
+		 * @brief Check if the body is a bullet
+		 * @return true if the body is a bullet
+		 */
+		[[nodiscard]] bool IsBullet() const noexcept;
 
         /**
          * @brief Set the position of the body
@@ -97,6 +112,12 @@ namespace Physics
          * @param useGravity The new use gravity of the body
          */
         void SetUseGravity(bool useGravity) noexcept;
+		/**
+		 * @brief Set if the body is a bullet. A dynamic bullet that moves far enough in a step is stopped at the first static collider on its way
+		 * instead of going through it. Costs more than a normal body, only for fast bodies
+		 * @param isBullet true if the body is a bullet
+		 */
+		void SetIsBullet(bool isBullet) noexcept;
 
         /**
          * @brief Apply a force to the body (add it to the current force)
@@ -129,5 +150,19 @@ namespace Physics
          * @return true if the body is enabled
          */
 		[[nodiscard]] bool IsEnabled() const noexcept;
+
+		/**
+		 * @brief Check if the body is awake, a sleeping body is not moved by the world until it is woken up
+		 * @return true if the body is awake
+		 */
+		[[nodiscard]] bool IsAwake() const noexcept;
+		/**
+		 * @brief Wake up the body. Changing its position, type or velocity, or adding a non-zero force, velocity or position also wakes it up
+		 */
+		void WakeUp() noexcept;
+		/**
+		 * @brief Put the body to sleep, clears its velocity and force
+		 */
+		void Sleep() noexcept;
 	};
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "Shape.h"
 #include "Ref.h"
 
+#include <array>
+#include <span>
 #include <variant>
 
 namespace Physics
@@ -18,6 +20,8 @@ namespace Physics
 	private:
         std::variant<Math::CircleF, Math::RectangleF, Math::PolygonF> _shape { Math::CircleF(Math::Vec2F::Zero(), 1.f) };
         Math::RectangleF _bounds { Math::Vec2F::Zero(), Math::Vec2F::One() };
+		// Outward normals of the polygon edges, edge i goes from vertex i to vertex i + 1, computed when the polygon is set
+		std::array<Math::Vec2F, Math::PolygonF::MaxVerticesCount> _edgeNormals {};
 		BodyRef _bodyRef {};
 		ColliderRef _colliderRef {};
         Math::Vec2F _offset { Math::Vec2F::Zero() };
@@ -34,6 +38,10 @@ namespace Physics
 		 * @return the shape
 		 */
         [[nodiscard]] Math::RectangleF getBounds() const noexcept;
+		/**
+		 * @brief Compute the outward normals of the polygon edges, whatever the winding of its vertices
+		 */
+		void computeEdgeNormals() noexcept;
 
 	public:
         /**
@@ -126,7 +134,7 @@ namespace Physics
          * @brief Set the shape of the collider to a polygon
          * @param polygon the polygon
          */
-		void SetPolygon(Math::PolygonF polygon) noexcept;
+		void SetPolygon(const Math::PolygonF& polygon) noexcept;
 
         /**
          * @brief Enable the collider
@@ -159,9 +167,14 @@ namespace Physics
         [[nodiscard]] Math::RectangleF GetRectangle() const noexcept;
         /**
          * @brief Get the polygon of the collider
-         * @return the polygon
+         * @return the polygon, without the position and the offset of the collider
          */
-		[[nodiscard]] Math::PolygonF GetPolygon() const noexcept;
+		[[nodiscard]] const Math::PolygonF& GetPolygon() const noexcept;
+		/**
+		 * @brief Get the outward normals of the polygon edges, the normal i is the one of the edge from the vertex i to the vertex i + 1
+		 * @return the normals, as many as the polygon vertices
+		 */
+		[[nodiscard]] std::span<const Math::Vec2F> GetEdgeNormals() const noexcept;
 		/**
 		 * @brief Get the shape of the collider with the correct position
 		 * @return the shape
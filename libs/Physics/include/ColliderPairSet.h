@@ -0,0 +1,71 @@
+#pragma once
+
+#include "ColliderPair.h"
+
+#include "Allocator.h"
+
+#include <cstdint>
+
+namespace Physics
+{
+	/**
+	 * @brief An open addressing hash set of collider pairs, the order of the colliders in a pair does not matter.
+	 * Used to know in constant time if a pair was already colliding at the last step.
+	 * Each pair can carry an index, to find data stored for it elsewhere
+	 */
+	class ColliderPairSet
+	{
+	public:
+		explicit ColliderPairSet(Allocator& allocator) noexcept;
+
+	private:
+		MyVector<ColliderPair> _pairs;
+		MyVector<std::uint8_t> _usedSlots;
+		MyVector<std::size_t> _indices;
+		std::size_t _size { 0 };
+
+		static constexpr std::size_t _minCapacity = 16;
+
+		/**
+		 * @brief Hash of the packed indices of the colliders, the same for (A, B) and (B, A)
+		 */
+		[[nodiscard]] static std::size_t hash(const ColliderPair& pair) noexcept;
+		/**
+		 * @brief Get the slot containing the pair or the first empty slot where it would be stored
+		 */
+		[[nodiscard]] std::size_t findSlot(const ColliderPair& pair) const noexcept;
+		void rehash(std::size_t capacity) noexcept;
+
+	public:
+		/**
+		 * @brief Make sure the set can store the given number of pairs without rehashing
+		 * @param count The number of pairs
+		 */
+		void Reserve(std::size_t count) noexcept;
+		/**
+		 * @brief Insert a pair in the set
+		 * @param pair The pair to insert
+		 * @param index The index carried by the pair, unchanged if the pair was already in the set
+		 * @return True if the pair was not in the set
+		 */
+		bool Insert(const ColliderPair& pair, std::size_t index = 0) noexcept;
+		/**
+		 * @brief Check if the pair is in the set
+		 * @param pair The pair to check
+		 * @return True if the pair is in the set
+		 */
+		[[nodiscard]] bool Contains(const ColliderPair& pair) const noexcept;
+		/**
+		 * @brief Get the index carried by a pair
+		 * @param pair The pair to find
+		 * @return The index given when the pair was inserted, nullptr if the pair is not in the set
+		 */
+		[[nodiscard]] const std::size_t* Find(const ColliderPair& pair) const noexcept;
+		/**
+		 * @brief Remove all the pairs, keeps the memory
+		 */
+		void Clear() noexcept;
+
+		[[nodiscard]] std::size_t Size() const noexcept { return _size; }
+	};
+}
@@ -2,6 +2,7 @@
 
 #include "Body.h"
 #include "Collider.h"
+#include "Manifold.h"
 
 namespace Physics
 {
@@ -32,15 +33,11 @@ namespace Physics
 
 	public:
 		/**
-		 * @brief Calculate the contact between the two colliders, applying the correct forces to the bodies and resolving the collision
+		 * @brief Calculate the contact manifold between the two colliders, applying the correct forces to the bodies and resolving the collision
 		 */
 		void ResolveContact() noexcept;
 
 	private:
-		/**
-		 * @brief Setup the contact between the two colliders
-		 */
-		void setupContact() noexcept;
 		/**
 		 * @brief Resolve the collision between the two colliders
 		 */
@@ -49,18 +46,5 @@ namespace Physics
 		 * @brief Resolve the position of the two colliders
 		 */
 		void resolvePosition() noexcept;
-
-		/**
-		 * @brief Resolve the collision between two circles
-		 */
-		void resolveCircleToCircle() noexcept;
-		/**
-		 * @brief Resolve the collision between two rectangles
-		 */
-		void resolveRectangleToRectangle() noexcept;
-		/**
-		 * @brief Resolve the collision between a circle and a rectangle
-		 */
-		void resolveCircleToRectangle() noexcept;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Body.h"
+#include "ColliderPair.h"
+#include "ColliderPairSet.h"
+#include "Manifold.h"
+
+#include "Allocator.h"
+
+namespace Physics
+{
+	/**
+	 * @brief Sequential impulse solver, resolves all the contacts of a step together instead of one after the other.
+	 * The impulses of a contact are kept for the next step to start from them (warm starting),
+	 * and the penetration is corrected on the positions only (split impulse) so it does not add energy to the bodies
+	 */
+	class ContactSolver
+	{
+	public:
+		explicit ContactSolver(Allocator& allocator) noexcept;
+
+	private:
+		/**
+		 * @brief A contact between two bodies, bodies without mass have an inverse mass of 0
+		 */
+		struct Constraint
+		{
+			ColliderPair Pair;
+			std::size_t BodyA;
+			std::size_t BodyB;
+			Math::Vec2F Normal;
+			float Penetration;
+			float InverseMassA;
+			float InverseMassB;
+			float EffectiveMass;
+			float TargetVelocity;
+			float Impulse;
+		};
+
+		struct CachedImpulse
+		{
+			ColliderPair Pair;
+			float Impulse;
+		};
+
+		MyVector<Constraint> _constraints;
+		// Impulses of the last step, found by pair
+		MyVector<CachedImpulse> _cachedImpulses;
+		ColliderPairSet _cachedImpulseIndices;
+		// Velocities and position corrections of the bodies while solving, indexed like the bodies of the world
+		MyVector<Math::Vec2F> _velocities;
+		MyVector<Math::Vec2F> _positionCorrections;
+
+		std::size_t _velocityIterations { 0 };
+		std::size_t _positionIterations { 0 };
+
+	public:
+		/**
+		 * @brief Ratio of the penetration corrected at each position iteration
+		 */
+		static constexpr float Baumgarte = 0.2f;
+		/**
+		 * @brief Penetration allowed without correction, keeps resting contacts alive between steps
+		 */
+		static constexpr float Slop = 0.01f;
+
+		/**
+		 * @brief Remove the contacts of the last step, keeps their impulses for warm starting
+		 */
+		void Clear() noexcept;
+		/**
+		 * @brief Add a contact to solve
+		 * @param pair The colliders in contact
+		 * @param bodyIndexA The index of the body of the first collider
+		 * @param bodyA The body of the first collider
+		 * @param bodyIndexB The index of the body of the second collider
+		 * @param bodyB The body of the second collider
+		 * @param manifold The contact, its normal goes from the second body to the first one
+		 * @param restitution The restitution of the contact
+		 */
+		void AddContact(const ColliderPair& pair, std::size_t bodyIndexA, const Body& bodyA,
+			std::size_t bodyIndexB, const Body& bodyB, const Manifold& manifold, float restitution) noexcept;
+		/**
+		 * @brief Solve the contacts added since the last Clear and apply the new velocities and positions to the dynamic bodies
+		 * @param bodies The bodies of the world
+		 */
+		void Solve(MyVector<Body>& bodies) noexcept;
+
+		/**
+		 * @brief Set the number of iterations of the solver, more iterations give more stable stacks
+		 * @param velocityIterations The number of passes on the velocities, 0 disables the solver
+		 * @param positionIterations The number of passes to correct the penetration
+		 */
+		void SetIterations(std::size_t velocityIterations, std::size_t positionIterations) noexcept;
+		[[nodiscard]] bool IsEnabled() const noexcept { return _velocityIterations > 0; }
+		[[nodiscard]] std::size_t ContactCount() const noexcept { return _constraints.size(); }
+	};
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Collider.h"
+
+#include <array>
+#include <cstddef>
+
+namespace Physics
+{
+	/**
+	 * @brief The contact between two colliders, found with the separating axis theorem
+	 */
+	struct Manifold
+	{
+		/**
+		 * @brief Direction in which the first collider must move to separate from the second one
+		 */
+		Math::Vec2F Normal { Math::Vec2F::Zero() };
+		/**
+		 * @brief Depth of the deepest contact point along the normal
+		 */
+		float Penetration { 0.f };
+		/**
+		 * @brief Contact points in world space, only the first PointCount are valid
+		 */
+		std::array<Math::Vec2F, 2> Points {};
+		/**
+		 * @brief Number of contact points, 0 when the colliders are separated
+		 */
+		std::size_t PointCount { 0 };
+	};
+
+	/**
+	 * @brief Compute the contact manifold between two colliders of any shape.
+	 * Rectangles are treated as polygons with axis aligned normals, polygons must be convex
+	 * @param colliderA The first collider
+	 * @param positionA The position of the body of the first collider, the offset of the collider is added
+	 * @param colliderB The second collider
+	 * @param positionB The position of the body of the second collider, the offset of the collider is added
+	 * @return The manifold, with no points if the colliders are separated
+	 */
+	[[nodiscard]] Manifold ComputeManifold(const Collider& colliderA, Math::Vec2F positionA,
+		const Collider& colliderB, Math::Vec2F positionB) noexcept;
+}
@@ -20,43 +20,88 @@ namespace Physics
     };
 
 	/**
-	 * @brief A quadtree node that contains a boundary, a list of colliders and a boolean that indicates if the node has been divided
+	 * @brief A quadtree node that contains a boundary, the range of its colliders in the sorted colliders of the quadtree and a boolean that indicates if the node has been divided
 	 */
     struct QuadNode
     {
-		explicit QuadNode(HeapAllocator& allocator) noexcept;
-
-	    MyVector<SimplifiedCollider> Colliders;
         Math::RectangleF Boundary {Math::Vec2F::Zero(), Math::Vec2F::One()};
+        // Index of the first collider of the node in the sorted colliders
+        std::size_t Begin {0};
+        // Number of colliders stored in the node
+        std::size_t Count {0};
+        // Bounds of all the colliders of the node and its children, used to skip nodes when searching pairs
+        Math::RectangleF ContentBounds {Math::Vec2F::Zero(), Math::Vec2F::Zero()};
         bool Divided {false};
     };
 
 	/**
-	 * @brief A quadtree that contains a list of quadtree nodes and a list of all possible pairs of colliders
+	 * @brief A quadtree that contains a list of quadtree nodes and a list of all possible pairs of colliders.
+	 * Colliders are stored in one contiguous array, sorted by node (counting sort) only when needed
 	 */
 	class QuadTree
 	{
 	public:
+		static constexpr std::size_t DefaultMaxDepth = 1;
+		static constexpr std::size_t DefaultMaxCapacity = 8;
+
         /**
          * @brief Preallocate quadtree nodes with 4^MaxDepth nodes
          * @param boundary The boundary of the quadtree
+         * @param maxDepth The maximum depth of the quadtree, the root is at depth 0
+         * @param maxCapacity The number of colliders a node can contain before being divided
          */
-		explicit QuadTree(const Math::RectangleF& boundary) noexcept;
+		explicit QuadTree(const Math::RectangleF& boundary, std::size_t maxDepth = DefaultMaxDepth,
+			std::size_t maxCapacity = DefaultMaxCapacity) noexcept;
 
 	private:
-		HeapAllocator _nodesAllocator;
-		HeapAllocator _heapAllocator {};
-		MyVector<QuadNode> _nodes { StandardAllocator <QuadNode> {_nodesAllocator} };
+		HeapAllocator _heapAllocator {MemoryTag::QuadTree};
+		MyVector<QuadNode> _nodes { StandardAllocator <QuadNode> {_heapAllocator} };
+		// Colliders in insertion order and the node index of each of them
+		MyVector<SimplifiedCollider> _colliders { StandardAllocator <SimplifiedCollider> {_heapAllocator} };
+		MyVector<std::size_t> _colliderNodes { StandardAllocator <std::size_t> {_heapAllocator} };
+		// Colliders sorted by node, each node points to its range
+		MyVector<SimplifiedCollider> _sortedColliders { StandardAllocator <SimplifiedCollider> {_heapAllocator} };
+		// Bounds of the sorted colliders as a structure of arrays, padded to be tested in batches
+		MyVector<float> _sortedMinX { StandardAllocator <float> {_heapAllocator} };
+		MyVector<float> _sortedMinY { StandardAllocator <float> {_heapAllocator} };
+		MyVector<float> _sortedMaxX { StandardAllocator <float> {_heapAllocator} };
+		MyVector<float> _sortedMaxY { StandardAllocator <float> {_heapAllocator} };
+		MyVector<std::size_t> _nodeOffsets { StandardAllocator <std::size_t> {_heapAllocator} };
 		MyVector<ColliderPair> _allPossiblePairs { StandardAllocator <ColliderPair> {_heapAllocator} };
+		// Index + 1 in _colliders of each collider index stored in the quadtree, 0 if the collider is not in the quadtree
+		MyVector<std::size_t> _colliderEntries { StandardAllocator <std::size_t> {_heapAllocator} };
+		bool _pairsDirty { true };
+		bool _sortDirty { true };
 
-        static constexpr std::size_t _maxDepth = 1;
-		static constexpr std::size_t _maxCapacity = 8;
+        std::size_t _maxDepth;
+		std::size_t _maxCapacity;
 
-        static constexpr std::size_t getMaxNodes() noexcept;
-        static constexpr std::size_t getDepth(std::size_t index) noexcept;
+        [[nodiscard]] static constexpr std::size_t getMaxNodes(std::size_t maxDepth) noexcept;
+        [[nodiscard]] static constexpr std::size_t getDepth(std::size_t index) noexcept;
 
         void subdivide(std::size_t index) noexcept;
-		void addAllPossiblePairs(std::size_t index, const SimplifiedCollider& collider) noexcept;
+		/**
+		 * @brief Get the child of a divided node that is the only one to intersect the bounds
+		 * @return The index of the child, or the index of the node if the bounds intersect more or less than one child
+		 */
+		[[nodiscard]] std::size_t getTargetNode(std::size_t index, const Math::RectangleF& bounds) const noexcept;
+		/**
+		 * @brief Sort the colliders by node with a counting sort and update the range and content bounds of each node
+		 */
+		void sortColliders() noexcept;
+		void addAllPossiblePairs(std::size_t index, const SimplifiedCollider& collider, MyVector<ColliderPair>& pairs) const noexcept;
+		/**
+		 * @brief Add the pairs between a collider and the sorted colliders in [begin, end) that intersect it, tested in batches
+		 */
+		void addIntersectingPairs(const SimplifiedCollider& collider, std::size_t begin, std::size_t end, MyVector<ColliderPair>& pairs) const noexcept;
+		/**
+		 * @brief Push a collider in a node and remember where it is stored
+		 */
+		void pushCollider(std::size_t index, const SimplifiedCollider& collider) noexcept;
+		/**
+		 * @brief Get the index + 1 of the collider in the colliders, 0 if the collider is not in the quadtree
+		 */
+		[[nodiscard]] std::size_t getColliderEntry(ColliderRef colliderRef) const noexcept;
 
     public:
 		/**
@@ -66,10 +111,38 @@ namespace Physics
 		 */
 		void Insert(SimplifiedCollider collider) noexcept;
 		/**
-		 * @brief Get all the possible pairs of colliders in the quadtree
+		 * @brief Remove a collider from the quadtree, does nothing if the collider is not in the quadtree
+		 * @param colliderRef The collider to remove
+		 */
+		void Remove(ColliderRef colliderRef) noexcept;
+		/**
+		 * @brief Update the bounds of a collider already in the quadtree, reinsert it only if its bounds changed
+		 * @param collider The collider with its new bounds
+		 */
+		void Move(SimplifiedCollider collider) noexcept;
+		/**
+		 * @brief Check if a collider is stored in the quadtree
+		 * @param colliderRef The collider to check
+		 * @return True if the collider is in the quadtree
+		 */
+		[[nodiscard]] bool Contains(ColliderRef colliderRef) const noexcept;
+		/**
+		 * @brief Check if the bounds are fully inside the boundary of the quadtree
+		 * @param bounds The bounds to check
+		 * @return True if the bounds are inside the boundary
+		 */
+		[[nodiscard]] bool IsInBoundary(const Math::RectangleF& bounds) const noexcept;
+		/**
+		 * @brief Get all the possible pairs of colliders in the quadtree, only recomputed if the colliders changed since the last call
 		 * @return All the possible pairs of colliders in the quadtree
 		 */
 		[[nodiscard]] const MyVector<ColliderPair>& GetAllPossiblePairs() noexcept;
+		/**
+		 * @brief Add all the possible pairs between a collider that is not in the quadtree and the colliders of the quadtree
+		 * @param collider The collider to test against the quadtree
+		 * @param pairs The pairs to add to
+		 */
+		void AddPossiblePairs(const SimplifiedCollider& collider, MyVector<ColliderPair>& pairs) noexcept;
 
 		/**
 		 * @brief Set the new boundary of the quadtree, applies to all nodes
@@ -93,7 +166,7 @@ namespace Physics
 		 */
 		[[nodiscard]] std::size_t GetAllCollidersCount() const noexcept;
 
-		static constexpr std::size_t MaxDepth() noexcept { return _maxDepth; }
-		static constexpr std::size_t MaxCapacity() noexcept { return _maxCapacity; }
+		[[nodiscard]] std::size_t MaxDepth() const noexcept { return _maxDepth; }
+		[[nodiscard]] std::size_t MaxCapacity() const noexcept { return _maxCapacity; }
 	};
 }
\ No newline at end of file
@@ -21,7 +21,7 @@ namespace Physics
 
         constexpr bool operator!=(const Ref& other) const noexcept
         {
-            return *this != other;
+            return !(*this == other);
         }
     };
 
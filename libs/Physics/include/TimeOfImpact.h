@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Collider.h"
+
+namespace Physics
+{
+	/**
+	 * @brief The first contact of a collider moving toward another one
+	 */
+	struct TimeOfImpact
+	{
+		/**
+		 * @brief Fraction of the displacement done before the contact, between 0 and 1
+		 */
+		float Time { 1.f };
+		/**
+		 * @brief Normal of the surface hit, pointing toward the moving collider
+		 */
+		Math::Vec2F Normal { Math::Vec2F::Zero() };
+		bool IsHit { false };
+	};
+
+	/**
+	 * @brief Sweep a collider along a displacement and find when it first touches another collider.
+	 * Two circles are swept exactly, any other pair is swept as the circle or the bounds of the moving collider against the bounds of the target,
+	 * so a target that is not a rectangle is hit a bit early
+	 * @param collider The moving collider
+	 * @param position The position of the body of the moving collider at the start of the displacement
+	 * @param displacement The displacement of the body
+	 * @param target The collider that does not move, at its current position
+	 * @return The time of impact, not a hit if the colliders already overlap at the start or never touch
+	 */
+	[[nodiscard]] TimeOfImpact ComputeTimeOfImpact(const Collider& collider, Math::Vec2F position, Math::Vec2F displacement,
+		const Collider& target) noexcept;
+}
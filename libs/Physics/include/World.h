@@ -3,10 +3,14 @@
 #include "Body.h"
 #include "Collider.h"
 #include "ColliderPair.h"
+#include "ColliderPairSet.h"
 #include "ContactListener.h"
+#include "ContactSolver.h"
 #include "QuadTree.h"
 #include "Allocator.h"
+#include "JobSystem.h"
 
+#include <memory>
 #include <vector>
 #include <unordered_set>
 
@@ -23,13 +27,66 @@ namespace Physics
 		 * @param defaultBodySize The default size of the bodies vector
 		 */
         explicit World(std::size_t defaultBodySize = 500) noexcept;
+		/**
+		 * @brief Copy the bodies, colliders and settings, the copy uses its own allocators
+		 */
+		World(const World& other) noexcept;
+		World(World&& other) noexcept;
 		~World() noexcept = default;
 
+		World& operator=(const World& other) = default;
+		World& operator=(World&& other) = default;
+
     private:
+		// Colliders of non-static bodies, cleared and filled every update
 		QuadTree _quadTree {Math::RectangleF(Math::Vec2F::Zero(), Math::Vec2F::One())};
-	    HeapAllocator _heapAllocator;
+		// Colliders of static bodies, only updated when a static collider is added, moved or removed
+		QuadTree _staticQuadTree {Math::RectangleF(Math::Vec2F::Zero(), Math::Vec2F::One())};
+	    HeapAllocator _heapAllocator {MemoryTag::Physics};
+		// Memory of the buffers only used during a step, cleared at the start of each step
+		FrameAllocator _frameAllocator {0, MemoryTag::Physics};
 
+		// Colliding pairs of the last and the current step, the current ones are copied into the last ones at the end of each step.
+		// Never swap them: the last ones are on the heap and the current ones in the frame allocator, cleared at the next step
 		MyVector<ColliderPair> _lastColliderPairs;
+		MyVector<ColliderPair> _newColliderPairs;
+		ColliderPairSet _lastColliderPairSet;
+		ColliderPairSet _newColliderPairSet;
+		MyVector<ColliderPair> _possibleColliderPairs;
+		MyVector<SimplifiedCollider> _dynamicColliders;
+		// Indices of the enabled dynamic bodies, filled every update
+		MyVector<std::size_t> _dynamicBodies;
+		// Bullets moved by this step and their positions before it
+		MyVector<std::size_t> _bullets;
+		MyVector<Math::Vec2F> _bulletStartPositions;
+		// Colliders of the bullets grouped by bullet, the ones of the bullet i start at _bulletColliderOffsets[i]
+		MyVector<std::size_t> _bulletColliders;
+		MyVector<std::size_t> _bulletColliderOffsets;
+		// Colliders of the moving bodies a bullet can hit, and the static colliders on the way of the bullet being swept
+		MyVector<std::size_t> _movingSweepTargets;
+		MyVector<ColliderPair> _sweptPairs;
+		// Result of the narrowphase for each possible pair
+		MyVector<std::uint8_t> _possiblePairOverlaps;
+		// Contacts to resolve in parallel mode, grouped by color so contacts of a color share no dynamic body
+		MyVector<ColliderPair> _contacts;
+		MyVector<ColliderPair> _coloredContacts;
+		MyVector<std::size_t> _contactColors;
+		MyVector<std::size_t> _colorOffsets;
+		// Colors already used by each body, one bit per color
+		MyVector<std::uint64_t> _bodyColors;
+		// Solves the contacts together when enabled, instead of resolving them one by one
+		ContactSolver _contactSolver;
+
+		// Union-find of the dynamic bodies in contact, and the state of each island
+		MyVector<std::size_t> _islandParents;
+		MyVector<std::uint8_t> _islandCanSleep;
+
+		float _sleepVelocity { 1.f };
+		// Sleeping is opt-in, a world only puts its bodies to sleep after a call to SetSleepThreshold
+		std::uint32_t _sleepFrames { 0 };
+
+		// Shared by the copies of the world, nullptr when the world runs on the calling thread only
+		std::shared_ptr<JobSystem> _jobSystem;
 	    MyVector<Body> _bodies;
 		MyVector<Collider> _colliders;
 	    MyVector<std::size_t> _colliderGenerations;
@@ -39,19 +96,56 @@ namespace Physics
 
         Math::Vec2F _gravity;
 
+		/**
+		 * @brief Empty the buffers of the last step and give their memory back to the frame allocator
+		 */
+		void clearFrameAllocator() noexcept;
 		/**
 		 * @brief Check the collisions and triggers of the colliders
 		 */
 		void updateColliders() noexcept;
 		/**
-		 * @brief Check the collisions and triggers of the colliders in the quadtree
+		 * @brief Synchronize the static quadtree with the colliders of static bodies, rebuild it only when a collider goes out of its boundary
+		 */
+		void updateStaticColliders() noexcept;
+		/**
+		 * @brief Clear the static quadtree and insert all the colliders of static bodies with a new boundary
+		 */
+		void rebuildStaticQuadTree() noexcept;
+		/**
+		 * @brief Insert the colliders of non-static bodies in the quadtree
 		 */
 		void insertColliders() noexcept;
+		/**
+		 * @brief Check if the collider is enabled and attached to a body that does not move: a static or sleeping body
+		 */
+		[[nodiscard]] bool isStaticCollider(const Collider& collider) noexcept;
+		/**
+		 * @brief Fill the new collider pairs with the pairs of colliders that overlap
+		 */
+        void updateColliderPairs() noexcept;
 		/**
 		 * @brief Check the collisions and triggers of the colliders in the quadtree
 		 */
-        MyVector<ColliderPair> getColliderPairs() noexcept;
 		void processColliders() noexcept;
+		/**
+		 * @brief Check if the colliders of a possible pair really collide
+		 */
+		[[nodiscard]] bool isPairColliding(const ColliderPair& colliderPair) noexcept;
+		/**
+		 * @brief Resolve the contacts collected during processColliders in parallel mode.
+		 * Contacts are colored in their order so that contacts of the same color share no dynamic body,
+		 * colors are resolved one after the other and the contacts of a color in parallel
+		 */
+		void resolveContacts() noexcept;
+		/**
+		 * @brief Solve the contacts collected during processColliders with the contact solver
+		 */
+		void solveContacts() noexcept;
+		/**
+		 * @brief Wake up the bodies of a contact and resolve it, or keep it to resolve it after the callbacks
+		 */
+		void addContact(const ColliderPair& colliderPair) noexcept;
 		/**
 		 * @brief Calculate the collisions of the colliders
 		 * @param colliderRef The collider to check the collisions for
@@ -71,6 +165,31 @@ namespace Physics
 		 * @param deltaTime The time since the last update
 		 */
 		void updateBodies(float deltaTime) noexcept;
+		/**
+		 * @brief Apply gravity and forces to the dynamic bodies and move them, 4 bodies at a time
+		 * @param deltaTime The time since the last update
+		 */
+		void integrateDynamicBodies(float deltaTime) noexcept;
+		/**
+		 * @brief Group the colliders of each bullet and list the colliders of the moving bodies, in one pass over the colliders
+		 */
+		void collectSweptColliders() noexcept;
+		/**
+		 * @brief Move back the bullets that went through a collider during the integration to their first contact with it,
+		 * then slide them along the surface with the rest of their displacement, up to a few contacts per step.
+		 * The moving colliders are swept with the displacement of the bullet relative to them
+		 */
+		void sweepBullets() noexcept;
+		/**
+		 * @brief Bounds covering a rectangle along its whole displacement
+		 */
+		[[nodiscard]] static Math::RectangleF getSweptBounds(const Math::RectangleF& bounds, Math::Vec2F displacement) noexcept;
+		/**
+		 * @brief Count the steps each dynamic body has been resting, group the bodies in contact in islands,
+		 * put to sleep the islands where all bodies are resting and wake up the islands with a moving body
+		 */
+		void updateSleep() noexcept;
+		[[nodiscard]] std::size_t findIsland(std::size_t bodyIndex) noexcept;
 
     public:
 		/**
@@ -95,6 +214,7 @@ namespace Physics
 		 * @return The body
 		 */
         Body& GetBody(BodyRef bodyRef);
+		[[nodiscard]] const Body& GetBody(BodyRef bodyRef) const;
 
 		/**
 		 * @brief Create a collider for a body. Sets the bodyRef and colliderRef of the collider. Enables the collider.
@@ -113,6 +233,7 @@ namespace Physics
 		 * @return The collider
 		 */
 		Collider& GetCollider(ColliderRef colliderRef);
+		[[nodiscard]] const Collider& GetCollider(ColliderRef colliderRef) const;
 
 		/**
 		 * @brief Set the contact listener of the world for collision and trigger events, there is only one callback for both events
@@ -131,5 +252,30 @@ namespace Physics
 		 * @param gravity The gravity of the world
 		 */
         void SetGravity(Math::Vec2F gravity) noexcept;
+
+		/**
+		 * @brief Set the number of threads used for the narrowphase and the contact resolution.
+		 * With 0 (default), everything runs on the calling thread and contacts are resolved as soon as they are found.
+		 * With 1 or more, contacts are resolved after all the callbacks, in an order that does not depend on the number of threads
+		 * @note Copies of the world share the same threads
+		 * @param threadCount The number of threads, including the calling thread
+		 */
+		void SetThreadCount(std::size_t threadCount) noexcept;
+
+		/**
+		 * @brief Set when dynamic bodies go to sleep, they are then skipped by the integration and the broadphase until woken up
+		 * @param velocity The speed under which a body is resting
+		 * @param frameCount The number of consecutive steps a whole island must be resting to sleep, 0 disables sleeping, the default
+		 */
+		void SetSleepThreshold(float velocity, std::uint32_t frameCount) noexcept;
+
+		/**
+		 * @brief Set the number of iterations of the contact solver.
+		 * With 0 velocity iterations (default), each contact is resolved once, when it stays for a second step.
+		 * Otherwise, all the contacts of a step are solved together on the calling thread, from their first step
+		 * @param velocityIterations The number of passes on the velocities of the bodies in contact
+		 * @param positionIterations The number of passes to push the bodies out of each other
+		 */
+		void SetSolverIterations(std::size_t velocityIterations, std::size_t positionIterations = 3) noexcept;
     };
 }
\ No newline at end of file
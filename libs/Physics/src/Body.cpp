@@ -15,6 +15,8 @@ namespace Physics
 
 	void Body::SetPosition(Math::Vec2F position) noexcept
 	{
+		if (position != _position) WakeUp();
+
 		_position = position;
 	}
 
@@ -27,6 +29,8 @@ namespace Physics
 	{
         if (_bodyType == BodyType::Static) return;
 
+		if (velocity != _velocity) WakeUp();
+
 		_velocity = velocity;
 	}
 
@@ -67,6 +71,8 @@ namespace Physics
     {
         _bodyType = bodyType;
 
+        WakeUp();
+
         if (bodyType == BodyType::Dynamic) return;
 
 	    _mass = 0.f;
@@ -84,18 +90,34 @@ namespace Physics
         _useGravity = useGravity;
     }
 
+	[[nodiscard]] bool Body::IsBullet() const noexcept
+	{
+		return _isBullet;
+	}
+
+	void Body::SetIsBullet(bool isBullet) noexcept
+	{
+		_isBullet = isBullet;
+	}
+
 	void Body::AddForce(Math::Vec2F force) noexcept
 	{
+		if (force != Math::Vec2F::Zero()) WakeUp();
+
 		_force += force;
 	}
 
     void Body::AddVelocity(Math::Vec2F velocity) noexcept
     {
+		if (velocity != Math::Vec2F::Zero()) WakeUp();
+
         _velocity += velocity;
     }
 
     void Body::AddPosition(Math::Vec2F position) noexcept
     {
+		if (position != Math::Vec2F::Zero()) WakeUp();
+
         _position += position;
     }
 
@@ -108,6 +130,9 @@ namespace Physics
 		_force = Math::Vec2F(0, 0);
 		_inverseMass = 0.f;
         _bodyType = BodyType::Dynamic;
+		_isBullet = false;
+		_isAwake = true;
+		_restFrames = 0;
 	}
 
 	void Body::Enable() noexcept
@@ -120,4 +145,24 @@ namespace Physics
 	{
 		return _mass >= 0.f;
 	}
+
+	[[nodiscard]] bool Body::IsAwake() const noexcept
+	{
+		return _isAwake;
+	}
+
+	void Body::WakeUp() noexcept
+	{
+		if (_isAwake) return;
+
+		_isAwake = true;
+		_restFrames = 0;
+	}
+
+	void Body::Sleep() noexcept
+	{
+		_isAwake = false;
+		_velocity = Math::Vec2F::Zero();
+		_force = Math::Vec2F::Zero();
+	}
 }
\ No newline at end of file
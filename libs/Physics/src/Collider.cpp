@@ -87,12 +87,13 @@ namespace Physics
         _bounds = getBounds();
 	}
 
-	void Collider::SetPolygon(Math::PolygonF polygon) noexcept
+	void Collider::SetPolygon(const Math::PolygonF& polygon) noexcept
 	{
 		_shapeType = Math::ShapeType::Polygon;
 		_shape = polygon;
 
         _bounds = getBounds();
+		computeEdgeNormals();
 	}
 
 	void Collider::Enable() noexcept
@@ -123,11 +124,16 @@ namespace Physics
 		return std::get<Math::RectangleF>(_shape);
 	}
 
-	Math::PolygonF Collider::GetPolygon() const noexcept
+	const Math::PolygonF& Collider::GetPolygon() const noexcept
 	{
         return std::get<Math::PolygonF>(_shape);
 	}
 
+	std::span<const Math::Vec2F> Collider::GetEdgeNormals() const noexcept
+	{
+		return { _edgeNormals.data(), GetPolygon().Vertices().size() };
+	}
+
 	Math::ShapeType Collider::GetShapeType() const noexcept
 	{
 		return _shapeType;
@@ -151,11 +157,10 @@ namespace Physics
 			{
 				float minX = std::numeric_limits<float>::max();
 				float minY = std::numeric_limits<float>::max();
-				float maxX = std::numeric_limits<float>::min();
-				float maxY = std::numeric_limits<float>::min();
-				Math::PolygonF polygon = GetPolygon();
+				float maxX = std::numeric_limits<float>::lowest();
+				float maxY = std::numeric_limits<float>::lowest();
 
-				for (auto& vertex : polygon.Vertices())
+				for (const auto& vertex : GetPolygon().Vertices())
 				{
 					minX = std::min(minX, vertex.X);
 					minY = std::min(minY, vertex.Y);
@@ -171,6 +176,31 @@ namespace Physics
 		return {Math::Vec2F::Zero(), Math::Vec2F::Zero()};
 	}
 
+	void Collider::computeEdgeNormals() noexcept
+	{
+		const auto vertices = GetPolygon().Vertices();
+		float doubleArea = 0.f;
+
+		for (std::size_t i = 0; i < vertices.size(); i++)
+		{
+			const auto& vertex = vertices[i];
+			const auto& next = vertices[(i + 1) % vertices.size()];
+
+			doubleArea += vertex.X * next.Y - next.X * vertex.Y;
+		}
+
+		// The normal (y, -x) of an edge points outside when the vertices go counterclockwise
+		const float orientation = doubleArea < 0.f ? -1.f : 1.f;
+
+		for (std::size_t i = 0; i < vertices.size(); i++)
+		{
+			const auto edge = vertices[(i + 1) % vertices.size()] - vertices[i];
+			const auto length = edge.Length();
+
+			_edgeNormals[i] = length > 0.f ? Math::Vec2F(edge.Y, -edge.X) * (orientation / length) : Math::Vec2F::Zero();
+		}
+	}
+
     Math::RectangleF Collider::GetBounds() const noexcept
     {
         return _bounds + _position;
@@ -0,0 +1,113 @@
+#include "ColliderPairSet.h"
+
+#include <algorithm>
+
+namespace Physics
+{
+	ColliderPairSet::ColliderPairSet(Allocator& allocator) noexcept :
+		_pairs { StandardAllocator<ColliderPair> {allocator} },
+		_usedSlots { StandardAllocator<std::uint8_t> {allocator} },
+		_indices { StandardAllocator<std::size_t> {allocator} } {}
+
+	std::size_t ColliderPairSet::hash(const ColliderPair& pair) noexcept
+	{
+		const auto minIndex = static_cast<std::uint64_t>(std::min(pair.A.Index, pair.B.Index));
+		const auto maxIndex = static_cast<std::uint64_t>(std::max(pair.A.Index, pair.B.Index));
+		const auto key = minIndex << 32 | (maxIndex & 0xFFFFFFFF);
+
+		// Fibonacci hashing, spreads the packed indices on the high bits
+		return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+
+	std::size_t ColliderPairSet::findSlot(const ColliderPair& pair) const noexcept
+	{
+		const auto mask = _pairs.size() - 1;
+		auto slot = hash(pair) & mask;
+
+		// Linear probing, the set is never full so an empty slot is always found
+		while (_usedSlots[slot] && !(_pairs[slot] == pair))
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		return slot;
+	}
+
+	void ColliderPairSet::rehash(std::size_t capacity) noexcept
+	{
+		auto pairs = _pairs;
+		auto usedSlots = _usedSlots;
+		auto indices = _indices;
+
+		_pairs.assign(capacity, ColliderPair{});
+		_usedSlots.assign(capacity, 0);
+		_indices.assign(capacity, 0);
+
+		for (std::size_t i = 0; i < pairs.size(); i++)
+		{
+			if (!usedSlots[i]) continue;
+
+			const auto slot = findSlot(pairs[i]);
+
+			_pairs[slot] = pairs[i];
+			_usedSlots[slot] = 1;
+			_indices[slot] = indices[i];
+		}
+	}
+
+	void ColliderPairSet::Reserve(std::size_t count) noexcept
+	{
+		// Keep the load factor under 50% to have short probe sequences
+		auto capacity = std::max(_pairs.size(), _minCapacity);
+
+		while (capacity < count * 2)
+		{
+			capacity *= 2;
+		}
+
+		if (capacity != _pairs.size())
+		{
+			rehash(capacity);
+		}
+	}
+
+	bool ColliderPairSet::Insert(const ColliderPair& pair, std::size_t index) noexcept
+	{
+		Reserve(_size + 1);
+
+		const auto slot = findSlot(pair);
+
+		if (_usedSlots[slot]) return false;
+
+		_pairs[slot] = pair;
+		_usedSlots[slot] = 1;
+		_indices[slot] = index;
+		_size++;
+
+		return true;
+	}
+
+	bool ColliderPairSet::Contains(const ColliderPair& pair) const noexcept
+	{
+		if (_size == 0) return false;
+
+		return _usedSlots[findSlot(pair)];
+	}
+
+	const std::size_t* ColliderPairSet::Find(const ColliderPair& pair) const noexcept
+	{
+		if (_size == 0) return nullptr;
+
+		const auto slot = findSlot(pair);
+
+		return _usedSlots[slot] ? &_indices[slot] : nullptr;
+	}
+
+	void ColliderPairSet::Clear() noexcept
+	{
+		if (_size == 0) return;
+
+		std::fill(_usedSlots.begin(), _usedSlots.end(), 0);
+		_size = 0;
+	}
+}
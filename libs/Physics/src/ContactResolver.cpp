@@ -8,9 +8,13 @@ namespace Physics
 
 	void ContactResolver::ResolveContact() noexcept
 	{
-		if (_colliderA->GetShapeType() == Math::ShapeType::Polygon || _colliderB->GetShapeType() == Math::ShapeType::Polygon) return;
+		const auto manifold = ComputeManifold(*_colliderA, _bodyA->Position(), *_colliderB, _bodyB->Position());
 
-		setupContact();
+		// The bounds overlap but the shapes do not, nothing to resolve
+		if (manifold.PointCount == 0) return;
+
+		_normal = manifold.Normal;
+		_penetration = manifold.Penetration;
 
 		if (_bodyA->GetBodyType() == BodyType::Static || _bodyA->GetBodyType() == BodyType::Kinematic)
 		{
@@ -24,40 +28,6 @@ namespace Physics
 		resolvePosition();
 	}
 
-	void ContactResolver::setupContact() noexcept
-	{
-		switch (_colliderA->GetShapeType())
-		{
-			case Math::ShapeType::Circle:
-				switch (_colliderB->GetShapeType())
-				{
-					case Math::ShapeType::Circle: resolveCircleToCircle(); break;
-					case Math::ShapeType::Rectangle: resolveCircleToRectangle(); break;
-					case Math::ShapeType::Polygon:
-					case Math::ShapeType::None:break;
-				}
-				break;
-			case Math::ShapeType::Rectangle:
-				switch (_colliderB->GetShapeType())
-				{
-					case Math::ShapeType::Circle:
-					{
-						std::swap(_bodyA, _bodyB);
-						std::swap(_colliderA, _colliderB);
-
-						resolveCircleToRectangle();
-					}
-					break;
-					case Math::ShapeType::Rectangle: resolveRectangleToRectangle(); break;
-					case Math::ShapeType::Polygon:
-					case Math::ShapeType::None:break;
-				}
-				break;
-			case Math::ShapeType::Polygon:
-			case Math::ShapeType::None:break;
-		}
-	}
-
 	void ContactResolver::resolveCollision() noexcept
 	{
 		const auto& separatingVelocity = (_bodyA->Velocity() - _bodyB->Velocity()).Dot(_normal);
@@ -111,75 +81,4 @@ namespace Physics
 			_bodyB->AddPosition(movePerMass * -inverseMassB);
 		}
 	}
-
-	void ContactResolver::resolveCircleToCircle() noexcept
-	{
-		const auto& circleA = _colliderA->GetCircle();
-		const auto& circleB = _colliderB->GetCircle();
-		const auto& radiusA = circleA.Radius();
-		const auto& radiusB = circleB.Radius();
-		const auto& positionA = _bodyA->Position() + circleA.Center() + _colliderA->GetOffset();
-		const auto& positionB = _bodyB->Position() + circleB.Center() + _colliderB->GetOffset();
-
-		const auto& delta = positionA - positionB;
-
-		_normal = delta.Normalized();
-		_penetration = radiusA + radiusB - delta.Length();
-	}
-
-	void ContactResolver::resolveRectangleToRectangle() noexcept
-	{
-		const auto& rectangleA = _colliderA->GetRectangle();
-		const auto& rectangleB = _colliderB->GetRectangle();
-		const auto& positionA = _bodyA->Position() + rectangleA.Center() + _colliderA->GetOffset();
-		const auto& positionB = _bodyB->Position() + rectangleB.Center() + _colliderB->GetOffset();
-
-		const auto& delta = positionA - positionB;
-
-		const auto& halfSizeA = rectangleA.HalfSize();
-		const auto& halfSizeB = rectangleB.HalfSize();
-
-		const auto& penetrationX = halfSizeA.X + halfSizeB.X - std::abs(delta.X);
-		const auto& penetrationY = halfSizeA.Y + halfSizeB.Y - std::abs(delta.Y);
-
-		if (penetrationX < penetrationY)
-		{
-			_normal = delta.X > 0 ? Math::Vec2F::Right() : Math::Vec2F::Left();
-			_penetration = penetrationX;
-		}
-		else
-		{
-			_normal = delta.Y > 0 ? Math::Vec2F::Up() : Math::Vec2F::Down();
-			_penetration = penetrationY;
-		}
-	}
-
-	void ContactResolver::resolveCircleToRectangle() noexcept
-	{
-		const auto& circle = _colliderA->GetCircle();
-		const auto& rectangle = _colliderB->GetRectangle();
-		const auto& circleCenter = _bodyA->Position() + circle.Center() + _colliderA->GetOffset();
-		const auto& rectCenter = _bodyB->Position() + rectangle.Center() + _colliderB->GetOffset();
-
-		const auto& delta = circleCenter - rectCenter;
-		const auto& radius = circle.Radius();
-		const auto& halfSize = rectangle.HalfSize();
-		Math::Vec2F closestPoint
-		{
-			Math::Clamp(delta.X, -halfSize.X, halfSize.X),
-			Math::Clamp(delta.Y, -halfSize.Y, halfSize.Y)
-		};
-
-		const auto& distance = (closestPoint - delta).Length();
-		const auto& closestPointRect = rectCenter + closestPoint;
-		auto circleToRect = circleCenter - closestPointRect;
-
-		if (circleToRect.Length() <= Math::Epsilon)
-		{
-			circleToRect = Math::Vec2F::Up();
-		}
-
-		_normal = circleToRect.Normalized();
-		_penetration = radius - distance;
-	}
-}
\ No newline at end of file
+}
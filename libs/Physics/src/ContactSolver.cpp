@@ -0,0 +1,135 @@
+#include "ContactSolver.h"
+
+#include <algorithm>
+
+namespace Physics
+{
+	ContactSolver::ContactSolver(Allocator& allocator) noexcept :
+		_constraints { StandardAllocator<Constraint> {allocator} },
+		_cachedImpulses { StandardAllocator<CachedImpulse> {allocator} },
+		_cachedImpulseIndices { allocator },
+		_velocities { StandardAllocator<Math::Vec2F> {allocator} },
+		_positionCorrections { StandardAllocator<Math::Vec2F> {allocator} } {}
+
+	void ContactSolver::Clear() noexcept
+	{
+		_constraints.clear();
+	}
+
+	void ContactSolver::AddContact(const ColliderPair& pair, std::size_t bodyIndexA, const Body& bodyA,
+		std::size_t bodyIndexB, const Body& bodyB, const Manifold& manifold, float restitution) noexcept
+	{
+		const auto inverseMassA = bodyA.GetBodyType() == BodyType::Dynamic ? bodyA.InverseMass() : 0.f;
+		const auto inverseMassB = bodyB.GetBodyType() == BodyType::Dynamic ? bodyB.InverseMass() : 0.f;
+		const auto totalInverseMass = inverseMassA + inverseMassB;
+
+		if (totalInverseMass <= 0.f) return;
+
+		// Bounce back with a part of the approaching velocity
+		const auto approachingVelocity = (bodyA.Velocity() - bodyB.Velocity()).Dot(manifold.Normal);
+		const auto targetVelocity = approachingVelocity < 0.f ? -approachingVelocity * restitution : 0.f;
+
+		const auto* cachedIndex = _cachedImpulseIndices.Find(pair);
+
+		_constraints.push_back({
+			pair, bodyIndexA, bodyIndexB, manifold.Normal, manifold.Penetration,
+			inverseMassA, inverseMassB, 1.f / totalInverseMass, targetVelocity,
+			cachedIndex != nullptr ? _cachedImpulses[*cachedIndex].Impulse : 0.f
+		});
+	}
+
+	void ContactSolver::Solve(MyVector<Body>& bodies) noexcept
+	{
+		_velocities.resize(bodies.size());
+		_positionCorrections.resize(bodies.size());
+
+		for (const auto& constraint : _constraints)
+		{
+			_velocities[constraint.BodyA] = bodies[constraint.BodyA].Velocity();
+			_velocities[constraint.BodyB] = bodies[constraint.BodyB].Velocity();
+			_positionCorrections[constraint.BodyA] = Math::Vec2F::Zero();
+			_positionCorrections[constraint.BodyB] = Math::Vec2F::Zero();
+		}
+
+		// Warm starting, apply the impulses found at the last step
+		for (const auto& constraint : _constraints)
+		{
+			const auto impulse = constraint.Normal * constraint.Impulse;
+
+			_velocities[constraint.BodyA] += impulse * constraint.InverseMassA;
+			_velocities[constraint.BodyB] -= impulse * constraint.InverseMassB;
+		}
+
+		for (std::size_t iteration = 0; iteration < _velocityIterations; iteration++)
+		{
+			for (auto& constraint : _constraints)
+			{
+				const auto relativeVelocity = (_velocities[constraint.BodyA] - _velocities[constraint.BodyB]).Dot(constraint.Normal);
+				const auto totalImpulse = std::max(constraint.Impulse + (constraint.TargetVelocity - relativeVelocity) * constraint.EffectiveMass, 0.f);
+				const auto impulse = constraint.Normal * (totalImpulse - constraint.Impulse);
+
+				// Contacts can only push, the clamp is on the sum of the impulses so an iteration can take back a part of the last one
+				constraint.Impulse = totalImpulse;
+
+				_velocities[constraint.BodyA] += impulse * constraint.InverseMassA;
+				_velocities[constraint.BodyB] -= impulse * constraint.InverseMassB;
+			}
+		}
+
+		for (std::size_t iteration = 0; iteration < _positionIterations; iteration++)
+		{
+			for (const auto& constraint : _constraints)
+			{
+				const auto corrected = (_positionCorrections[constraint.BodyA] - _positionCorrections[constraint.BodyB]).Dot(constraint.Normal);
+				const auto penetration = constraint.Penetration - corrected;
+
+				if (penetration <= Slop) continue;
+
+				const auto correction = constraint.Normal * (Baumgarte * (penetration - Slop) * constraint.EffectiveMass);
+
+				_positionCorrections[constraint.BodyA] += correction * constraint.InverseMassA;
+				_positionCorrections[constraint.BodyB] -= correction * constraint.InverseMassB;
+			}
+		}
+
+		for (auto& constraint : _constraints)
+		{
+			for (const auto bodyIndex : { constraint.BodyA, constraint.BodyB })
+			{
+				auto& body = bodies[bodyIndex];
+
+				if (body.GetBodyType() != BodyType::Dynamic) continue;
+
+				body.SetVelocity(_velocities[bodyIndex]);
+				body.SetPosition(body.Position() + _positionCorrections[bodyIndex]);
+
+				// A body in several contacts is only moved once
+				_positionCorrections[bodyIndex] = Math::Vec2F::Zero();
+			}
+		}
+
+		// Keep the impulses for the next step
+		_cachedImpulses.clear();
+		_cachedImpulseIndices.Clear();
+		_cachedImpulseIndices.Reserve(_constraints.size());
+
+		for (const auto& constraint : _constraints)
+		{
+			if (_cachedImpulseIndices.Insert(constraint.Pair, _cachedImpulses.size()))
+			{
+				_cachedImpulses.push_back({ constraint.Pair, constraint.Impulse });
+			}
+		}
+	}
+
+	void ContactSolver::SetIterations(std::size_t velocityIterations, std::size_t positionIterations) noexcept
+	{
+		_velocityIterations = velocityIterations;
+		_positionIterations = positionIterations;
+
+		if (velocityIterations != 0) return;
+
+		_cachedImpulses.clear();
+		_cachedImpulseIndices.Clear();
+	}
+}
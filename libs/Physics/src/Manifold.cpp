@@ -0,0 +1,358 @@
+#include "Manifold.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+
+namespace Physics
+{
+	/**
+	 * @brief A convex shape seen as translated vertices and the outward normals of its edges, edge i goes from vertex i to vertex i + 1
+	 */
+	struct ConvexShape
+	{
+		std::span<const Math::Vec2F> Vertices;
+		std::span<const Math::Vec2F> Normals;
+		Math::Vec2F Translation;
+
+		[[nodiscard]] Math::Vec2F Vertex(std::size_t index) const noexcept
+		{
+			return Vertices[index] + Translation;
+		}
+	};
+
+	/**
+	 * @brief Normals of a rectangle for the vertex order of rectangleVertices
+	 */
+	static constexpr std::array<Math::Vec2F, 4> RectangleNormals {
+		Math::Vec2F(0.f, -1.f), Math::Vec2F(1.f, 0.f), Math::Vec2F(0.f, 1.f), Math::Vec2F(-1.f, 0.f)
+	};
+
+	[[nodiscard]] static std::array<Math::Vec2F, 4> rectangleVertices(const Math::RectangleF& rectangle) noexcept
+	{
+		const auto minBound = rectangle.MinBound();
+		const auto maxBound = rectangle.MaxBound();
+
+		return { minBound, Math::Vec2F(maxBound.X, minBound.Y), maxBound, Math::Vec2F(minBound.X, maxBound.Y) };
+	}
+
+	/**
+	 * @brief Find the edge of the shape A that separates the most the shape B
+	 * @param edge The index of this edge
+	 * @return The separation along the normal of this edge, negative when the shapes overlap on every edge
+	 */
+	[[nodiscard]] static float findMaxSeparation(const ConvexShape& shapeA, const ConvexShape& shapeB, std::size_t& edge) noexcept
+	{
+		auto maxSeparation = std::numeric_limits<float>::lowest();
+
+		for (std::size_t i = 0; i < shapeA.Vertices.size(); i++)
+		{
+			const auto normal = shapeA.Normals[i];
+			const auto vertex = shapeA.Vertex(i);
+			auto separation = std::numeric_limits<float>::max();
+
+			for (std::size_t j = 0; j < shapeB.Vertices.size(); j++)
+			{
+				separation = std::min(separation, normal.Dot(shapeB.Vertex(j) - vertex));
+			}
+
+			if (separation > maxSeparation)
+			{
+				maxSeparation = separation;
+				edge = i;
+			}
+		}
+
+		return maxSeparation;
+	}
+
+	/**
+	 * @brief Keep the part of the segment that is behind the plane, the segment is unchanged if it is fully behind
+	 * @return The number of points left, 2 if the segment crosses or is behind the plane
+	 */
+	[[nodiscard]] static std::size_t clipSegment(std::array<Math::Vec2F, 2>& segment, Math::Vec2F normal, float offset) noexcept
+	{
+		const auto distance0 = normal.Dot(segment[0]) - offset;
+		const auto distance1 = normal.Dot(segment[1]) - offset;
+		std::array<Math::Vec2F, 2> clipped {};
+		std::size_t count = 0;
+
+		if (distance0 <= 0.f) clipped[count++] = segment[0];
+		if (distance1 <= 0.f) clipped[count++] = segment[1];
+
+		if (distance0 * distance1 < 0.f)
+		{
+			const auto t = distance0 / (distance0 - distance1);
+
+			clipped[count++] = segment[0] + (segment[1] - segment[0]) * t;
+		}
+
+		segment = clipped;
+
+		return count;
+	}
+
+	[[nodiscard]] static Manifold collidePolygons(const ConvexShape& shapeA, const ConvexShape& shapeB) noexcept
+	{
+		Manifold manifold;
+		std::size_t edgeA = 0, edgeB = 0;
+
+		const auto separationA = findMaxSeparation(shapeA, shapeB, edgeA);
+		if (separationA > 0.f) return manifold;
+
+		const auto separationB = findMaxSeparation(shapeB, shapeA, edgeB);
+		if (separationB > 0.f) return manifold;
+
+		// Prefer the edges of A when both are as good, so the result does not flicker between frames
+		static constexpr float RELATIVE_TOLERANCE = 0.98f;
+		static constexpr float ABSOLUTE_TOLERANCE = 0.001f;
+		const bool isReferenceA = separationB <= RELATIVE_TOLERANCE * separationA + ABSOLUTE_TOLERANCE;
+
+		const auto& reference = isReferenceA ? shapeA : shapeB;
+		const auto& incident = isReferenceA ? shapeB : shapeA;
+		const auto referenceEdge = isReferenceA ? edgeA : edgeB;
+		const auto referenceNormal = reference.Normals[referenceEdge];
+
+		// The incident edge is the edge of the other shape that faces the reference edge the most
+		std::size_t incidentEdge = 0;
+		auto minDot = std::numeric_limits<float>::max();
+
+		for (std::size_t i = 0; i < incident.Normals.size(); i++)
+		{
+			const auto dot = referenceNormal.Dot(incident.Normals[i]);
+
+			if (dot < minDot)
+			{
+				minDot = dot;
+				incidentEdge = i;
+			}
+		}
+
+		const auto vertex1 = reference.Vertex(referenceEdge);
+		const auto vertex2 = reference.Vertex((referenceEdge + 1) % reference.Vertices.size());
+		const auto tangent = vertex2 - vertex1;
+		std::array<Math::Vec2F, 2> segment {
+			incident.Vertex(incidentEdge),
+			incident.Vertex((incidentEdge + 1) % incident.Vertices.size())
+		};
+
+		// Clip the incident edge by the side planes of the reference edge
+		if (clipSegment(segment, -tangent, -tangent.Dot(vertex1)) < 2) return manifold;
+		if (clipSegment(segment, tangent, tangent.Dot(vertex2)) < 2) return manifold;
+
+		// Keep the points behind the reference edge
+		const auto referenceOffset = referenceNormal.Dot(vertex1);
+
+		for (const auto& point : segment)
+		{
+			const auto separation = referenceNormal.Dot(point) - referenceOffset;
+
+			if (separation > 0.f) continue;
+
+			manifold.Points[manifold.PointCount++] = point;
+			manifold.Penetration = std::max(manifold.Penetration, -separation);
+		}
+
+		// The normal of an edge of A points toward B, A must move the other way
+		manifold.Normal = isReferenceA ? -referenceNormal : referenceNormal;
+
+		return manifold;
+	}
+
+	/**
+	 * @return The manifold where the normal goes from the polygon to the circle
+	 */
+	[[nodiscard]] static Manifold collidePolygonAndCircle(const ConvexShape& polygon, Math::Vec2F center, float radius) noexcept
+	{
+		Manifold manifold;
+		std::size_t edge = 0;
+		auto maxSeparation = std::numeric_limits<float>::lowest();
+
+		for (std::size_t i = 0; i < polygon.Vertices.size(); i++)
+		{
+			const auto separation = polygon.Normals[i].Dot(center - polygon.Vertex(i));
+
+			if (separation > radius) return manifold;
+
+			if (separation > maxSeparation)
+			{
+				maxSeparation = separation;
+				edge = i;
+			}
+		}
+
+		const auto vertex1 = polygon.Vertex(edge);
+		const auto vertex2 = polygon.Vertex((edge + 1) % polygon.Vertices.size());
+		auto normal = polygon.Normals[edge];
+		auto penetration = radius - maxSeparation;
+
+		// Outside of the polygon, the closest feature may be a vertex of the edge instead of the edge itself
+		if (maxSeparation > 0.f)
+		{
+			const auto toCenter1 = center - vertex1;
+			const auto toCenter2 = center - vertex2;
+			const auto* vertex = toCenter1.Dot(vertex2 - vertex1) <= 0.f ? &toCenter1 :
+				toCenter2.Dot(vertex1 - vertex2) <= 0.f ? &toCenter2 : nullptr;
+
+			if (vertex != nullptr)
+			{
+				const auto distance = vertex->Length();
+
+				if (distance > radius) return manifold;
+
+				if (distance > Math::Epsilon)
+				{
+					normal = *vertex / distance;
+				}
+
+				penetration = radius - distance;
+			}
+		}
+
+		manifold.Normal = normal;
+		manifold.Penetration = penetration;
+		manifold.Points[0] = center - normal * radius;
+		manifold.PointCount = 1;
+
+		return manifold;
+	}
+
+	[[nodiscard]] static Manifold collideCircles(Math::Vec2F centerA, float radiusA, Math::Vec2F centerB, float radiusB) noexcept
+	{
+		Manifold manifold;
+		const auto delta = centerA - centerB;
+		const auto distance = delta.Length();
+
+		if (distance > radiusA + radiusB) return manifold;
+
+		manifold.Normal = distance > Math::Epsilon ? delta / distance : Math::Vec2F::Up();
+		manifold.Penetration = radiusA + radiusB - distance;
+		manifold.Points[0] = centerB + manifold.Normal * radiusB;
+		manifold.PointCount = 1;
+
+		return manifold;
+	}
+
+	/**
+	 * @brief Two axis aligned rectangles only have two axes to test, no need for the generic polygon path
+	 */
+	[[nodiscard]] static Manifold collideRectangles(const Math::RectangleF& rectangleA, const Math::RectangleF& rectangleB) noexcept
+	{
+		Manifold manifold;
+		const auto delta = rectangleA.Center() - rectangleB.Center();
+		const auto halfSizeA = rectangleA.HalfSize();
+		const auto halfSizeB = rectangleB.HalfSize();
+		const auto penetrationX = halfSizeA.X + halfSizeB.X - std::abs(delta.X);
+		const auto penetrationY = halfSizeA.Y + halfSizeB.Y - std::abs(delta.Y);
+
+		if (penetrationX < 0.f || penetrationY < 0.f) return manifold;
+
+		// The contact points are the ends of the overlap on the axis of least penetration
+		const Math::Vec2F minOverlap(std::max(rectangleA.MinBound().X, rectangleB.MinBound().X), std::max(rectangleA.MinBound().Y, rectangleB.MinBound().Y));
+		const Math::Vec2F maxOverlap(std::min(rectangleA.MaxBound().X, rectangleB.MaxBound().X), std::min(rectangleA.MaxBound().Y, rectangleB.MaxBound().Y));
+
+		if (penetrationX < penetrationY)
+		{
+			const auto x = delta.X > 0 ? minOverlap.X : maxOverlap.X;
+
+			manifold.Normal = delta.X > 0 ? Math::Vec2F::Right() : Math::Vec2F::Left();
+			manifold.Penetration = penetrationX;
+			manifold.Points = { Math::Vec2F(x, minOverlap.Y), Math::Vec2F(x, maxOverlap.Y) };
+		}
+		else
+		{
+			const auto y = delta.Y > 0 ? minOverlap.Y : maxOverlap.Y;
+
+			manifold.Normal = delta.Y > 0 ? Math::Vec2F::Up() : Math::Vec2F::Down();
+			manifold.Penetration = penetrationY;
+			manifold.Points = { Math::Vec2F(minOverlap.X, y), Math::Vec2F(maxOverlap.X, y) };
+		}
+
+		manifold.PointCount = 2;
+
+		return manifold;
+	}
+
+	[[nodiscard]] static Manifold flip(Manifold manifold) noexcept
+	{
+		manifold.Normal = -manifold.Normal;
+
+		return manifold;
+	}
+
+	Manifold ComputeManifold(const Collider& colliderA, Math::Vec2F positionA, const Collider& colliderB, Math::Vec2F positionB) noexcept
+	{
+		const auto translationA = positionA + colliderA.GetOffset();
+		const auto translationB = positionB + colliderB.GetOffset();
+		const auto shapeTypeA = colliderA.GetShapeType();
+		const auto shapeTypeB = colliderB.GetShapeType();
+
+		if (shapeTypeA == Math::ShapeType::None || shapeTypeB == Math::ShapeType::None) return {};
+
+		if (shapeTypeA == Math::ShapeType::Circle && shapeTypeB == Math::ShapeType::Circle)
+		{
+			const auto& circleA = colliderA.GetCircle();
+			const auto& circleB = colliderB.GetCircle();
+
+			return collideCircles(translationA + circleA.Center(), circleA.Radius(), translationB + circleB.Center(), circleB.Radius());
+		}
+
+		if (shapeTypeA == Math::ShapeType::Rectangle && shapeTypeB == Math::ShapeType::Rectangle)
+		{
+			return collideRectangles(colliderA.GetRectangle() + translationA, colliderB.GetRectangle() + translationB);
+		}
+
+		// Every other pair has at least one rectangle or polygon, seen as a convex shape
+		std::array<Math::Vec2F, 4> verticesA {}, verticesB {};
+		ConvexShape shapeA { {}, {}, translationA };
+		ConvexShape shapeB { {}, {}, translationB };
+
+		if (shapeTypeA == Math::ShapeType::Rectangle)
+		{
+			verticesA = rectangleVertices(colliderA.GetRectangle());
+			shapeA.Vertices = verticesA;
+			shapeA.Normals = RectangleNormals;
+		}
+		else if (shapeTypeA == Math::ShapeType::Polygon)
+		{
+			shapeA.Vertices = colliderA.GetPolygon().Vertices();
+			shapeA.Normals = colliderA.GetEdgeNormals();
+		}
+
+		if (shapeTypeB == Math::ShapeType::Rectangle)
+		{
+			verticesB = rectangleVertices(colliderB.GetRectangle());
+			shapeB.Vertices = verticesB;
+			shapeB.Normals = RectangleNormals;
+		}
+		else if (shapeTypeB == Math::ShapeType::Polygon)
+		{
+			shapeB.Vertices = colliderB.GetPolygon().Vertices();
+			shapeB.Normals = colliderB.GetEdgeNormals();
+		}
+
+		if (shapeTypeA == Math::ShapeType::Circle)
+		{
+			if (shapeB.Vertices.empty()) return {};
+
+			// The center of a circle is relative to the collider, like the vertices of the other shapes
+			const auto& circle = colliderA.GetCircle();
+
+			return collidePolygonAndCircle(shapeB, translationA + circle.Center(), circle.Radius());
+		}
+
+		if (shapeTypeB == Math::ShapeType::Circle)
+		{
+			if (shapeA.Vertices.empty()) return {};
+
+			const auto& circle = colliderB.GetCircle();
+
+			return flip(collidePolygonAndCircle(shapeA, translationB + circle.Center(), circle.Radius()));
+		}
+
+		if (shapeA.Vertices.empty() || shapeB.Vertices.empty()) return {};
+
+		return collidePolygons(shapeA, shapeB);
+	}
+}
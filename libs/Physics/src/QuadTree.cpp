@@ -1,5 +1,11 @@
 #include "QuadTree.h"
 
+#include "NRectangle.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
 #ifdef TRACY_ENABLE
 #include <tracy/Tracy.hpp>
 #include <fmt/format.h>
@@ -7,24 +13,38 @@
 
 namespace Physics
 {
-	QuadNode::QuadNode(HeapAllocator& allocator) noexcept :
-		Colliders {StandardAllocator<SimplifiedCollider> {allocator}} {}
+	namespace
+	{
+		void expandBounds(Math::RectangleF& bounds, const Math::RectangleF& other) noexcept
+		{
+			const auto& minBound = bounds.MinBound();
+			const auto& maxBound = bounds.MaxBound();
+			const auto& otherMinBound = other.MinBound();
+			const auto& otherMaxBound = other.MaxBound();
 
-	QuadTree::QuadTree(const Math::RectangleF& boundary) noexcept /*:
-		_nodesAllocator(std::malloc((getMaxNodes()) * sizeof(QuadNode) * 2), (getMaxNodes()) * sizeof(QuadNode) * 2)*/
+			bounds.SetMinBound(Math::Vec2F(std::min(minBound.X, otherMinBound.X), std::min(minBound.Y, otherMinBound.Y)));
+			bounds.SetMaxBound(Math::Vec2F(std::max(maxBound.X, otherMaxBound.X), std::max(maxBound.Y, otherMaxBound.Y)));
+		}
+	}
+
+	QuadTree::QuadTree(const Math::RectangleF& boundary, std::size_t maxDepth, std::size_t maxCapacity) noexcept :
+		_maxDepth(maxDepth), _maxCapacity(maxCapacity)
     {
-		_nodes.resize(getMaxNodes(), QuadNode {_heapAllocator});
+		_nodes.resize(getMaxNodes(_maxDepth));
+		_nodeOffsets.resize(_nodes.size(), 0);
 
         UpdateBoundary(boundary);
     }
 
-    constexpr std::size_t QuadTree::getMaxNodes() noexcept
+    constexpr std::size_t QuadTree::getMaxNodes(std::size_t maxDepth) noexcept
     {
         std::size_t nodes = 0;
+        std::size_t depthNodes = 1;
 
-        for (auto i = 0; i <= _maxDepth; i++)
+        for (std::size_t i = 0; i <= maxDepth; i++)
         {
-            nodes += static_cast<std::size_t>(Math::Pow(4, i));
+            nodes += depthNodes;
+            depthNodes *= 4;
         }
 
         return nodes;
@@ -36,13 +56,33 @@ namespace Physics
 
         while (index > 0)
         {
-            index /= 4;
+            index = (index - 1) / 4;
             depth++;
         }
 
         return depth;
     }
 
+	std::size_t QuadTree::getTargetNode(std::size_t index, const Math::RectangleF& bounds) const noexcept
+	{
+		std::size_t targetIndex = index;
+
+		for (auto i = 1; i <= 4; i++)
+		{
+			const auto childIndex = index * 4 + i;
+
+			if (Math::Intersect(_nodes[childIndex].Boundary, bounds))
+			{
+				// Collides with more than one child, stays in the node
+				if (targetIndex != index) return index;
+
+				targetIndex = childIndex;
+			}
+		}
+
+		return targetIndex;
+	}
+
     void QuadTree::subdivide(std::size_t index) noexcept
     {
 #ifdef TRACY_ENABLE
@@ -53,42 +93,56 @@ namespace Physics
 
         if (node.Divided) return;
 
-        _nodes[index].Divided = true;
-
-        const auto colliders = node.Colliders;
-
-        node.Colliders.clear();
+        node.Divided = true;
 
-        for (const auto& collider : colliders)
+        for (std::size_t i = 0; i < _colliders.size(); i++)
         {
-            std::size_t targetIndex = 0;
+            if (_colliderNodes[i] != index) continue;
 
-            for (auto i = 1; i <= 4; i++)
-            {
-                const auto& child = _nodes[index * 4 + i];
+            const auto targetIndex = getTargetNode(index, _colliders[i].Bounds);
 
-                if (Math::Intersect(child.Boundary, collider.Bounds))
-                {
-                    if (targetIndex != 0)
-                    {
-                        targetIndex = index;
-                        break;
-                    }
+            if (targetIndex == index) continue;
 
-                    targetIndex = index * 4 + i;
-                }
-            }
-
-            _nodes[targetIndex].Colliders.push_back(collider);
+            _colliderNodes[i] = targetIndex;
+            node.Count--;
+            _nodes[targetIndex].Count++;
         }
     }
 
+	void QuadTree::pushCollider(std::size_t index, const SimplifiedCollider& collider) noexcept
+	{
+		_colliders.push_back(collider);
+		_colliderNodes.push_back(index);
+		_nodes[index].Count++;
+
+		if (collider.Ref.Index >= _colliderEntries.size())
+		{
+			_colliderEntries.resize(collider.Ref.Index + 1, 0);
+		}
+
+		_colliderEntries[collider.Ref.Index] = _colliders.size();
+	}
+
+	std::size_t QuadTree::getColliderEntry(ColliderRef colliderRef) const noexcept
+	{
+		if (colliderRef.Index >= _colliderEntries.size()) return 0;
+
+		const auto entry = _colliderEntries[colliderRef.Index];
+
+		if (entry == 0 || _colliders[entry - 1].Ref != colliderRef) return 0;
+
+		return entry;
+	}
+
 	void QuadTree::Insert(SimplifiedCollider collider) noexcept
 	{
 #ifdef TRACY_ENABLE
 		ZoneNamedN(insert, "QuadTree::Insert", true);
 #endif
 
+        _pairsDirty = true;
+        _sortDirty = true;
+
         std::size_t parentIndex = 0;
 
         while (true)
@@ -97,26 +151,9 @@ namespace Physics
 
             if (node.Divided)
             {
-                // Check if it collides with more than one child
-                // True -> Push it in the parent
-                // False -> If parentIndex is at max depth, put it in, if not, set parentIndex to it
-                std::size_t targetIndex = 0;
-
-                for (auto i = 1; i <= 4; i++)
-                {
-                    const auto& child = _nodes[parentIndex * 4 + i];
-
-                    if (Math::Intersect(child.Boundary, collider.Bounds))
-                    {
-                        if (targetIndex != 0)
-                        {
-                            targetIndex = parentIndex;
-                            break;
-                        }
-
-                        targetIndex = parentIndex * 4 + i;
-                    }
-                }
+                // Collides with only one child -> go down in it
+                // Collides with more than one child -> push it in the parent
+                const auto targetIndex = getTargetNode(parentIndex, collider.Bounds);
 
                 if (targetIndex != parentIndex)
                 {
@@ -124,15 +161,15 @@ namespace Physics
                 }
                 else
                 {
-                    _nodes[targetIndex].Colliders.push_back(collider);
+                    pushCollider(targetIndex, collider);
                     break;
                 }
             }
             else
             {
-                node.Colliders.push_back(collider);
+                pushCollider(parentIndex, collider);
 
-                if (node.Colliders.size() > _maxCapacity && getDepth(parentIndex) < _maxDepth)
+                if (node.Count > _maxCapacity && getDepth(parentIndex) < _maxDepth)
                 {
                     subdivide(parentIndex);
                 }
@@ -142,23 +179,133 @@ namespace Physics
         }
 	}
 
-	void QuadTree::addAllPossiblePairs(std::size_t index, const SimplifiedCollider& collider) noexcept
+	void QuadTree::Remove(ColliderRef colliderRef) noexcept
 	{
 #ifdef TRACY_ENABLE
-		ZoneScoped;
+		ZoneNamedN(remove, "QuadTree::Remove", true);
 #endif
-		const auto& node = _nodes[index];
+		const auto entry = getColliderEntry(colliderRef);
+
+		if (entry == 0) return;
+
+		const auto index = entry - 1;
+		const auto lastIndex = _colliders.size() - 1;
+
+		_nodes[_colliderNodes[index]].Count--;
+		_colliderEntries[colliderRef.Index] = 0;
 
-		for (const auto & otherCollider : node.Colliders)
+		// Move the last collider in the free slot
+		if (index != lastIndex)
 		{
-			if (collider.Ref == otherCollider.Ref) continue;
+			_colliders[index] = _colliders[lastIndex];
+			_colliderNodes[index] = _colliderNodes[lastIndex];
+			_colliderEntries[_colliders[index].Ref.Index] = entry;
+		}
 
-			if (Math::Intersect(otherCollider.Bounds, collider.Bounds))
-			{
-				_allPossiblePairs.push_back(ColliderPair{collider.Ref, otherCollider.Ref});
-			}
+		_colliders.pop_back();
+		_colliderNodes.pop_back();
+
+		_pairsDirty = true;
+		_sortDirty = true;
+	}
+
+	void QuadTree::Move(SimplifiedCollider collider) noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(move, "QuadTree::Move", true);
+#endif
+		const auto entry = getColliderEntry(collider.Ref);
+
+		if (entry == 0) return;
+
+		const auto& bounds = _colliders[entry - 1].Bounds;
+
+		// Nothing to do if the collider did not move
+		if (bounds.MinBound() == collider.Bounds.MinBound() && bounds.MaxBound() == collider.Bounds.MaxBound()) return;
+
+		Remove(collider.Ref);
+		Insert(collider);
+	}
+
+	bool QuadTree::Contains(ColliderRef colliderRef) const noexcept
+	{
+		return getColliderEntry(colliderRef) != 0;
+	}
+
+	bool QuadTree::IsInBoundary(const Math::RectangleF& bounds) const noexcept
+	{
+		const auto& boundary = _nodes[0].Boundary;
+
+		return boundary.Contains(bounds.MinBound()) && boundary.Contains(bounds.MaxBound());
+	}
+
+	void QuadTree::sortColliders() noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(sortColliders, "QuadTree::sortColliders", true);
+#endif
+		if (!_sortDirty) return;
+
+		constexpr auto max = std::numeric_limits<float>::max();
+		constexpr auto lowest = std::numeric_limits<float>::lowest();
+
+		// The number of colliders of each node is already known, compute the start of each range
+		std::size_t offset = 0;
+
+		for (std::size_t i = 0; i < _nodes.size(); i++)
+		{
+			auto& node = _nodes[i];
+
+			node.Begin = offset;
+			node.ContentBounds.SetMinBound(Math::Vec2F(max, max));
+			node.ContentBounds.SetMaxBound(Math::Vec2F(lowest, lowest));
+			_nodeOffsets[i] = offset;
+			offset += node.Count;
+		}
+
+		_sortedColliders.resize(_colliders.size());
+
+		// A batch can start on the last collider, pad the arrays to always be able to read a full batch
+		const auto paddedSize = _colliders.size() + Math::IntersectBatchSize;
+		_sortedMinX.resize(paddedSize, 0.f);
+		_sortedMinY.resize(paddedSize, 0.f);
+		_sortedMaxX.resize(paddedSize, 0.f);
+		_sortedMaxY.resize(paddedSize, 0.f);
+
+		// Keeps the insertion order inside each node
+		for (std::size_t i = 0; i < _colliders.size(); i++)
+		{
+			const auto& collider = _colliders[i];
+			const auto sortedIndex = _nodeOffsets[_colliderNodes[i]]++;
+			const auto& minBound = collider.Bounds.MinBound();
+			const auto& maxBound = collider.Bounds.MaxBound();
+
+			_sortedColliders[sortedIndex] = collider;
+			_sortedMinX[sortedIndex] = minBound.X;
+			_sortedMinY[sortedIndex] = minBound.Y;
+			_sortedMaxX[sortedIndex] = maxBound.X;
+			_sortedMaxY[sortedIndex] = maxBound.Y;
+			expandBounds(_nodes[_colliderNodes[i]].ContentBounds, collider.Bounds);
+		}
+
+		// Children are always after their parent, propagate the bounds up to the root
+		for (auto i = _nodes.size() - 1; i > 0; i--)
+		{
+			expandBounds(_nodes[(i - 1) / 4].ContentBounds, _nodes[i].ContentBounds);
 		}
 
+		_sortDirty = false;
+	}
+
+	void QuadTree::addAllPossiblePairs(std::size_t index, const SimplifiedCollider& collider, MyVector<ColliderPair>& pairs) const noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneScoped;
+#endif
+		const auto& node = _nodes[index];
+
+		addIntersectingPairs(collider, node.Begin, node.Begin + node.Count, pairs);
+
 		if (node.Divided)
 		{
             const auto& nextIndex = index * 4 + 1;
@@ -166,37 +313,74 @@ namespace Physics
 
             for (auto j = nextIndex; j <= maxIndex; j++)
             {
-                addAllPossiblePairs(j, collider);
+                // Skip the nodes whose colliders cannot collide with this one
+                if (!Math::Intersect(_nodes[j].ContentBounds, collider.Bounds)) continue;
+
+                addAllPossiblePairs(j, collider, pairs);
             }
 		}
 	}
 
+	void QuadTree::addIntersectingPairs(const SimplifiedCollider& collider, std::size_t begin, std::size_t end, MyVector<ColliderPair>& pairs) const noexcept
+	{
+		const Math::RectanglesSoA rectangles { _sortedMinX.data(), _sortedMinY.data(), _sortedMaxX.data(), _sortedMaxY.data() };
+
+		for (auto i = begin; i < end; i += Math::IntersectBatchSize)
+		{
+			auto mask = Math::IntersectMask(collider.Bounds, rectangles, i);
+
+			// Ignore the colliders after the end of the range
+			if (end - i < Math::IntersectBatchSize)
+			{
+				mask &= (1u << (end - i)) - 1;
+			}
+
+			// Pairs are added in the same order as testing the colliders one by one
+			while (mask != 0)
+			{
+				const auto& otherCollider = _sortedColliders[i + std::countr_zero(mask)];
+
+				mask &= mask - 1;
+
+				if (collider.Ref == otherCollider.Ref) continue;
+
+				pairs.push_back(ColliderPair{collider.Ref, otherCollider.Ref});
+			}
+		}
+	}
+
+	void QuadTree::AddPossiblePairs(const SimplifiedCollider& collider, MyVector<ColliderPair>& pairs) noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(addPossiblePairs, "QuadTree::AddPossiblePairs", true);
+#endif
+		sortColliders();
+		addAllPossiblePairs(0, collider, pairs);
+	}
+
 	const MyVector<ColliderPair>& QuadTree::GetAllPossiblePairs() noexcept
 	{
 #ifdef TRACY_ENABLE
 		ZoneNamedN(GetAllPossiblePairs, "QuadTree::GetAllPossiblePairs", true);
 #endif
+		// Colliders did not change since the last call, the pairs are still valid
+		if (!_pairsDirty) return _allPossiblePairs;
+
+		sortColliders();
+
+		_allPossiblePairs.clear();
+
 		for (std::size_t parentIndex = 0; parentIndex < _nodes.size(); parentIndex++)
 		{
 			const auto& node = _nodes[parentIndex];
+			const auto end = node.Begin + node.Count;
 
-			for (auto i = 0; i < node.Colliders.size(); i++)
+			for (auto i = node.Begin; i < end; i++)
 			{
-				const auto& collider = node.Colliders[i];
-                const auto& ref = collider.Ref;
+				const auto& collider = _sortedColliders[i];
                 const auto& bounds = collider.Bounds;
 
-				for (auto j = i + 1; j < node.Colliders.size(); j++)
-				{
-					const auto& otherCollider = node.Colliders[j];
-
-					if (ref == otherCollider.Ref) continue;
-
-					if (Math::Intersect(bounds, otherCollider.Bounds))
-					{
-						_allPossiblePairs.push_back(ColliderPair{ref, otherCollider.Ref});
-					}
-				}
+				addIntersectingPairs(collider, i + 1, end, _allPossiblePairs);
 
 				if (node.Divided)
 				{
@@ -205,12 +389,16 @@ namespace Physics
 
 					for (auto j = index; j <= maxIndex; j++)
 					{
-						addAllPossiblePairs(j, collider);
+						if (!Math::Intersect(_nodes[j].ContentBounds, bounds)) continue;
+
+						addAllPossiblePairs(j, collider, _allPossiblePairs);
 					}
 				}
 			}
 		}
 
+		_pairsDirty = false;
+
 		return _allPossiblePairs;
 	}
 
@@ -223,7 +411,7 @@ namespace Physics
         _nodes[0].Boundary = boundary;
         std::size_t index = 1;
 
-        for (std::size_t i = 0; index < getMaxNodes(); i++)
+        for (std::size_t i = 0; index < _nodes.size(); i++)
         {
             const auto& bounds = _nodes[i].Boundary;
             const auto& minBound = bounds.MinBound();
@@ -245,11 +433,23 @@ namespace Physics
 	{
 		for (auto& node : _nodes)
         {
-            node.Colliders.clear();
+            node.Begin = 0;
+            node.Count = 0;
             node.Divided = false;
         }
 
+		for (const auto& collider : _colliders)
+		{
+			_colliderEntries[collider.Ref.Index] = 0;
+		}
+
+		_colliders.clear();
+		_colliderNodes.clear();
+		_sortedColliders.clear();
+
 		_allPossiblePairs.clear();
+		_pairsDirty = true;
+		_sortDirty = true;
 	}
 
 	std::vector<Math::RectangleF> QuadTree::GetBoundaries() const noexcept
@@ -260,7 +460,7 @@ namespace Physics
 
         for (auto& node : _nodes)
         {
-            if (node.Colliders.empty()) continue;
+            if (node.Count == 0) continue;
 
             boundaries.push_back(node.Boundary);
         }
@@ -270,13 +470,6 @@ namespace Physics
 
 	std::size_t QuadTree::GetAllCollidersCount() const noexcept
 	{
-		std::size_t count = 0;
-
-		for (auto& node : _nodes)
-        {
-            count += node.Colliders.size();
-        }
-
-		return count;
+		return _colliders.size();
 	}
 }
\ No newline at end of file
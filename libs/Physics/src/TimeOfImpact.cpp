@@ -0,0 +1,109 @@
+#include "TimeOfImpact.h"
+
+#include <cmath>
+#include <limits>
+
+namespace Physics
+{
+	/**
+	 * @brief Cast a ray against a rectangle with the slab method
+	 * @return Not a hit if the origin is already inside the rectangle
+	 */
+	[[nodiscard]] static TimeOfImpact raycastRectangle(Math::Vec2F origin, Math::Vec2F displacement, const Math::RectangleF& rectangle) noexcept
+	{
+		TimeOfImpact timeOfImpact;
+		auto enterTime = std::numeric_limits<float>::lowest();
+		auto exitTime = std::numeric_limits<float>::max();
+
+		for (int axis = 0; axis < 2; axis++)
+		{
+			const auto start = axis == 0 ? origin.X : origin.Y;
+			const auto delta = axis == 0 ? displacement.X : displacement.Y;
+			const auto min = axis == 0 ? rectangle.MinBound().X : rectangle.MinBound().Y;
+			const auto max = axis == 0 ? rectangle.MaxBound().X : rectangle.MaxBound().Y;
+
+			if (delta == 0.f)
+			{
+				// Parallel to this slab, the ray must already be between its sides
+				if (start < min || start > max) return timeOfImpact;
+
+				continue;
+			}
+
+			// The ray enters the slab by the side it moves toward
+			const auto enter = ((delta > 0.f ? min : max) - start) / delta;
+			const auto exit = ((delta > 0.f ? max : min) - start) / delta;
+
+			if (enter > enterTime)
+			{
+				enterTime = enter;
+				timeOfImpact.Normal = axis == 0 ? Math::Vec2F(delta > 0.f ? -1.f : 1.f, 0.f) : Math::Vec2F(0.f, delta > 0.f ? -1.f : 1.f);
+			}
+
+			exitTime = std::min(exitTime, exit);
+		}
+
+		if (enterTime > exitTime || enterTime < 0.f || enterTime > 1.f) return timeOfImpact;
+
+		timeOfImpact.Time = enterTime;
+		timeOfImpact.IsHit = true;
+
+		return timeOfImpact;
+	}
+
+	/**
+	 * @brief Cast a ray against a circle
+	 * @return Not a hit if the origin is already inside the circle
+	 */
+	[[nodiscard]] static TimeOfImpact raycastCircle(Math::Vec2F origin, Math::Vec2F displacement, Math::Vec2F center, float radius) noexcept
+	{
+		TimeOfImpact timeOfImpact;
+		const auto toOrigin = origin - center;
+		const auto approach = toOrigin.Dot(displacement);
+		const auto distance = toOrigin.SquareLength() - radius * radius;
+
+		// Already inside, or moving away
+		if (distance <= 0.f || approach >= 0.f) return timeOfImpact;
+
+		const auto squareLength = displacement.SquareLength();
+		const auto discriminant = approach * approach - squareLength * distance;
+
+		if (discriminant < 0.f) return timeOfImpact;
+
+		const auto time = (-approach - std::sqrt(discriminant)) / squareLength;
+
+		if (time > 1.f) return timeOfImpact;
+
+		timeOfImpact.Time = time;
+		timeOfImpact.Normal = (toOrigin + displacement * time) / radius;
+		timeOfImpact.IsHit = true;
+
+		return timeOfImpact;
+	}
+
+	TimeOfImpact ComputeTimeOfImpact(const Collider& collider, Math::Vec2F position, Math::Vec2F displacement,
+		const Collider& target) noexcept
+	{
+		if (displacement == Math::Vec2F::Zero()) return {};
+
+		const auto translation = position + collider.GetOffset();
+
+		if (collider.GetShapeType() == Math::ShapeType::Circle && target.GetShapeType() == Math::ShapeType::Circle)
+		{
+			const auto& circle = collider.GetCircle();
+			const auto& targetCircle = target.GetCircle();
+
+			// The centers of the circles are relative to their colliders
+			return raycastCircle(translation + circle.Center(), displacement, target.GetPosition() + targetCircle.Center(),
+				circle.Radius() + targetCircle.Radius());
+		}
+
+		// Sweep the center of the moving bounds against the target bounds grown by the half size of the moving bounds
+		const auto bounds = collider.GetBounds() + (translation - collider.GetPosition());
+		const auto halfSize = bounds.HalfSize();
+		const auto targetBounds = target.GetBounds();
+		const Math::RectangleF grownBounds(targetBounds.MinBound() - halfSize, targetBounds.MaxBound() + halfSize);
+
+		return raycastRectangle(bounds.Center(), displacement, grownBounds);
+	}
+}
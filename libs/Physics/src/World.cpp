@@ -2,6 +2,16 @@
 
 #include "Exception.h"
 #include "ContactResolver.h"
+#include "TimeOfImpact.h"
+
+#include "NVec2.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
 
 #ifdef TRACY_ENABLE
 #include <tracy/Tracy.hpp>
@@ -12,6 +22,27 @@ namespace Physics
 {
 	World::World(std::size_t defaultBodySize) noexcept :
 		_lastColliderPairs{StandardAllocator<ColliderPair> {_heapAllocator} },
+		_newColliderPairs{StandardAllocator<ColliderPair> {_frameAllocator} },
+		_lastColliderPairSet{_heapAllocator},
+		_newColliderPairSet{_heapAllocator},
+		_possibleColliderPairs{StandardAllocator<ColliderPair> {_frameAllocator} },
+		_dynamicColliders{StandardAllocator<SimplifiedCollider> {_frameAllocator} },
+		_dynamicBodies{StandardAllocator<std::size_t> {_heapAllocator} },
+		_bullets{StandardAllocator<std::size_t> {_heapAllocator} },
+		_bulletStartPositions{StandardAllocator<Math::Vec2F> {_heapAllocator} },
+		_bulletColliders{StandardAllocator<std::size_t> {_frameAllocator} },
+		_bulletColliderOffsets{StandardAllocator<std::size_t> {_frameAllocator} },
+		_movingSweepTargets{StandardAllocator<std::size_t> {_frameAllocator} },
+		_sweptPairs{StandardAllocator<ColliderPair> {_frameAllocator} },
+		_possiblePairOverlaps{StandardAllocator<std::uint8_t> {_frameAllocator} },
+		_contacts{StandardAllocator<ColliderPair> {_frameAllocator} },
+		_coloredContacts{StandardAllocator<ColliderPair> {_frameAllocator} },
+		_contactColors{StandardAllocator<std::size_t> {_frameAllocator} },
+		_colorOffsets{StandardAllocator<std::size_t> {_frameAllocator} },
+		_bodyColors{StandardAllocator<std::uint64_t> {_heapAllocator} },
+		_contactSolver{_heapAllocator},
+		_islandParents{StandardAllocator<std::size_t> {_heapAllocator} },
+		_islandCanSleep{StandardAllocator<std::uint8_t> {_heapAllocator} },
 		_bodies { StandardAllocator<Body> {_heapAllocator} },
 		_colliders { StandardAllocator<Collider> {_heapAllocator} },
 		_colliderGenerations { StandardAllocator<std::size_t> {_heapAllocator} },
@@ -28,20 +59,64 @@ namespace Physics
 		_colliderGenerations.resize(defaultBodySize, 0);
 	}
 
+	World::World(const World& other) noexcept : World(1)
+	{
+		*this = other;
+	}
+
+	World::World(World&& other) noexcept : World(1)
+	{
+		*this = std::move(other);
+	}
+
+	/**
+	 * @brief Give an empty vector on the same allocator, the memory of the old one is not given back to the frame allocator
+	 */
+	template<typename T>
+	static void resetFrameVector(MyVector<T>& vector) noexcept
+	{
+		vector = MyVector<T>(vector.get_allocator());
+	}
+
+	void World::clearFrameAllocator() noexcept
+	{
+		// The vectors must not keep pointers in the memory of the last step
+		resetFrameVector(_newColliderPairs);
+		resetFrameVector(_possibleColliderPairs);
+		resetFrameVector(_dynamicColliders);
+		resetFrameVector(_bulletColliders);
+		resetFrameVector(_bulletColliderOffsets);
+		resetFrameVector(_movingSweepTargets);
+		resetFrameVector(_sweptPairs);
+		resetFrameVector(_possiblePairOverlaps);
+		resetFrameVector(_contacts);
+		resetFrameVector(_coloredContacts);
+		resetFrameVector(_contactColors);
+		resetFrameVector(_colorOffsets);
+
+		_frameAllocator.Clear();
+	}
+
 	void World::updateColliders() noexcept
 	{
 #ifdef TRACY_ENABLE
 		ZoneNamedN(updateColliders, "World::updateColliders", true);
 #endif
-		// Calculate minimum and maximum bounds of all colliders
+		// Static colliders are kept in their own quadtree, only updated when they change
+		updateStaticColliders();
+
+		// Calculate minimum and maximum bounds of all non-static colliders
 		float minX = std::numeric_limits<float>::max();
 		float minY = std::numeric_limits<float>::max();
-		float maxX = std::numeric_limits<float>::min();
-		float maxY = std::numeric_limits<float>::min();
+		float maxX = std::numeric_limits<float>::lowest();
+		float maxY = std::numeric_limits<float>::lowest();
+
+		_dynamicColliders.clear();
+		_dynamicColliders.reserve(_colliders.size());
 
 		for (auto& collider : _colliders)
 		{
-			if (!collider.IsEnabled() || collider.IsFree()) continue;
+			if (!collider.IsEnabled() || isStaticCollider(collider)) continue;
 
 			const auto& bounds = collider.GetBounds();
 
@@ -52,13 +127,18 @@ namespace Physics
 			if (min.Y < minY) minY = min.Y;
 			if (max.X > maxX) maxX = max.X;
 			if (max.Y > maxY) maxY = max.Y;
+
+			_dynamicColliders.push_back({collider.GetColliderRef(), bounds});
 		}
 
 		// Clear all colliders from the quadtree
 		_quadTree.ClearColliders();
 
 		// Update the boundary of the quadtree
-		_quadTree.UpdateBoundary(Math::RectangleF({ minX, minY }, { maxX, maxY }));
+		if (!_dynamicColliders.empty())
+		{
+			_quadTree.UpdateBoundary(Math::RectangleF({ minX, minY }, { maxX, maxY }));
+		}
 
 		// Insert all colliders into the quadtree
 		insertColliders();
@@ -67,42 +147,160 @@ namespace Physics
 		processColliders();
 	}
 
-	void World::insertColliders() noexcept
+	void World::updateStaticColliders() noexcept
 	{
 #ifdef TRACY_ENABLE
-		ZoneNamedN(insertColliders, "World::insertColliders", true);
+		ZoneNamedN(updateStaticColliders, "World::updateStaticColliders", true);
 #endif
 
 		for (auto& collider : _colliders)
 		{
-			if (!collider.IsEnabled() || collider.IsFree()) continue;
+			// Free colliders are removed from the quadtree when destroyed
+			if (collider.IsFree()) continue;
 
-			_quadTree.Insert({collider.GetColliderRef(), collider.GetBounds()});
+			const auto& colliderRef = collider.GetColliderRef();
+
+			if (!isStaticCollider(collider))
+			{
+				// The body is not static anymore or the collider has been disabled
+				_staticQuadTree.Remove(colliderRef);
+				continue;
+			}
+
+			const SimplifiedCollider simplifiedCollider = {colliderRef, collider.GetBounds()};
+
+			if (!_staticQuadTree.IsInBoundary(simplifiedCollider.Bounds))
+			{
+				rebuildStaticQuadTree();
+				return;
+			}
+
+			if (_staticQuadTree.Contains(colliderRef))
+			{
+				_staticQuadTree.Move(simplifiedCollider);
+			}
+			else
+			{
+				_staticQuadTree.Insert(simplifiedCollider);
+			}
 		}
 	}
 
-    MyVector<ColliderPair> World::getColliderPairs() noexcept
+	void World::rebuildStaticQuadTree() noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(rebuildStaticQuadTree, "World::rebuildStaticQuadTree", true);
+#endif
+		float minX = std::numeric_limits<float>::max();
+		float minY = std::numeric_limits<float>::max();
+		float maxX = std::numeric_limits<float>::lowest();
+		float maxY = std::numeric_limits<float>::lowest();
+
+		for (auto& collider : _colliders)
+		{
+			if (!isStaticCollider(collider)) continue;
+
+			const auto& bounds = collider.GetBounds();
+
+			minX = std::min(minX, bounds.MinBound().X);
+			minY = std::min(minY, bounds.MinBound().Y);
+			maxX = std::max(maxX, bounds.MaxBound().X);
+			maxY = std::max(maxY, bounds.MaxBound().Y);
+		}
+
+		_staticQuadTree.ClearColliders();
+		_staticQuadTree.UpdateBoundary(Math::RectangleF({ minX, minY }, { maxX, maxY }));
+
+		for (auto& collider : _colliders)
+		{
+			if (!isStaticCollider(collider)) continue;
+
+			_staticQuadTree.Insert({collider.GetColliderRef(), collider.GetBounds()});
+		}
+	}
+
+	bool World::isStaticCollider(const Collider& collider) noexcept
+	{
+		if (!collider.IsEnabled()) return false;
+
+		const auto& body = GetBody(collider.GetBodyRef());
+
+		return body.GetBodyType() == BodyType::Static || (body.GetBodyType() == BodyType::Dynamic && !body.IsAwake());
+	}
+
+	void World::insertColliders() noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(insertColliders, "World::insertColliders", true);
+#endif
+
+		for (const auto& collider : _dynamicColliders)
+		{
+			_quadTree.Insert(collider);
+		}
+	}
+
+    void World::updateColliderPairs() noexcept
     {
 #ifdef TRACY_ENABLE
-        ZoneScopedN("World::getColliderPairs");
+        ZoneScopedN("World::updateColliderPairs");
 #endif
 
-        const auto& allPossibleColliderPairs = _quadTree.GetAllPossiblePairs();
-        MyVector<ColliderPair> newColliderPairs { StandardAllocator<ColliderPair> {_heapAllocator} };
+        {
+            PROFILE_SCOPE(broadphaseProfile, "World::broadphase");
+
+            const auto& dynamicPairs = _quadTree.GetAllPossiblePairs();
+            const auto& staticPairs = _staticQuadTree.GetAllPossiblePairs();
+
+            _possibleColliderPairs.clear();
+            _possibleColliderPairs.reserve(dynamicPairs.size() + staticPairs.size() + _dynamicColliders.size());
+            _possibleColliderPairs.insert(_possibleColliderPairs.end(), dynamicPairs.begin(), dynamicPairs.end());
+            _possibleColliderPairs.insert(_possibleColliderPairs.end(), staticPairs.begin(), staticPairs.end());
 
-        newColliderPairs.reserve(allPossibleColliderPairs.size());
+            // Pairs between the moving colliders and the static ones
+            for (const auto& collider : _dynamicColliders)
+            {
+                _staticQuadTree.AddPossiblePairs(collider, _possibleColliderPairs);
+            }
+        }
+
+        PROFILE_SCOPE(narrowphaseProfile, "World::narrowphase");
+
+        const auto& allPossibleColliderPairs = _possibleColliderPairs;
+
+        _newColliderPairs.clear();
+        _newColliderPairs.reserve(_lastColliderPairs.size());
+        _newColliderPairSet.Clear();
+        _newColliderPairSet.Reserve(allPossibleColliderPairs.size());
+        _possiblePairOverlaps.resize(allPossibleColliderPairs.size());
+
+        const JobSystem::RangeFunction testPairs = [this](std::size_t begin, std::size_t end)
+        {
+            for (auto i = begin; i < end; i++)
+            {
+                _possiblePairOverlaps[i] = isPairColliding(_possibleColliderPairs[i]);
+            }
+        };
+
+        // The pairs can be tested in any order, the results are read in the order of the pairs
+        if (_jobSystem != nullptr)
+        {
+            _jobSystem->ParallelFor(allPossibleColliderPairs.size(), 64, testPairs);
+        }
+        else
+        {
+            testPairs(0, allPossibleColliderPairs.size());
+        }
 
-        for (const auto& colliderPair : allPossibleColliderPairs)
+        for (std::size_t i = 0; i < allPossibleColliderPairs.size(); i++)
         {
-            const Collider& colliderA = GetCollider(colliderPair.A);
-            const Collider& colliderB = GetCollider(colliderPair.B);
+            if (!_possiblePairOverlaps[i]) continue;
 
-            if (colliderA.GetBodyRef() == colliderB.GetBodyRef()) continue;
+            const auto& colliderPair = allPossibleColliderPairs[i];
 
-            if (colliderA.GetShapeType() == Math::ShapeType::Rectangle && colliderB.GetShapeType() == Math::ShapeType::Rectangle ||
-                overlap(colliderA, colliderB))
+            if (_newColliderPairSet.Insert(colliderPair))
             {
-                newColliderPairs.push_back(colliderPair);
+                _newColliderPairs.push_back(colliderPair);
             }
         }
 
@@ -110,11 +308,19 @@ namespace Physics
 
         const auto& info = fmt::format(
                 "{} - {} = {} verified collider pairs",
-                allPossibleColliderPairs.size(), allPossibleColliderPairs.size() - newColliderPairs.size(), newColliderPairs.size());
+                allPossibleColliderPairs.size(), allPossibleColliderPairs.size() - _newColliderPairs.size(), _newColliderPairs.size());
         ZoneText(info.c_str(), info.size());
 #endif
+    }
+
+    bool World::isPairColliding(const ColliderPair& colliderPair) noexcept
+    {
+        const Collider& colliderA = GetCollider(colliderPair.A);
+        const Collider& colliderB = GetCollider(colliderPair.B);
 
-        return newColliderPairs;
+        if (colliderA.GetBodyRef() == colliderB.GetBodyRef()) return false;
+
+        return overlap(colliderA, colliderB);
     }
 
 	void World::processColliders() noexcept
@@ -122,56 +328,62 @@ namespace Physics
 #ifdef TRACY_ENABLE
         ZoneScopedN("World::processColliders");
 #endif
-		MyVector<ColliderPair> newColliderPairs = getColliderPairs();
+		updateColliderPairs();
+
+		_contacts.clear();
 
 #ifdef TRACY_ENABLE
         ZoneNamedN(onCollisions, "Check triggers and collisions", true);
 #endif
 
-		for (const auto& collider : newColliderPairs)
+		for (const auto& collider : _newColliderPairs)
 		{
 			const Collider& colliderA = GetCollider(collider.A);
 			const Collider& colliderB = GetCollider(collider.B);
+			const bool isTrigger = colliderA.IsTrigger() || colliderB.IsTrigger();
+			const bool isNew = !_lastColliderPairSet.Contains(collider);
 
-			if (std::find(_lastColliderPairs.begin(), _lastColliderPairs.end(), collider) == _lastColliderPairs.end())
+			if (_contactListener != nullptr)
 			{
-				if (_contactListener == nullptr) continue;
-
-				// Enter
-				if (colliderA.IsTrigger() || colliderB.IsTrigger())
+				if (isNew)
 				{
-					_contactListener->OnTriggerEnter(collider.A, collider.B);
-				}
-				else
-				{
-					_contactListener->OnCollisionEnter(collider.A, collider.B);
-				}
-			}
-			else
-			{
-				// Stay
-				if (colliderA.IsTrigger() || colliderB.IsTrigger())
-				{
-					if (_contactListener == nullptr) continue;
-
-					_contactListener->OnTriggerStay(collider.A, collider.B);
+					// Enter
+					if (isTrigger)
+					{
+						_contactListener->OnTriggerEnter(collider.A, collider.B);
+					}
+					else
+					{
+						_contactListener->OnCollisionEnter(collider.A, collider.B);
+					}
 				}
 				else
 				{
-					if (_contactListener != nullptr)
+					// Stay
+					if (isTrigger)
 					{
-						_contactListener->OnCollisionStay(collider.A, collider.B);
+						_contactListener->OnTriggerStay(collider.A, collider.B);
 					}
-
-					const auto& bodyA = GetBody(colliderA.GetBodyRef());
-					const auto& bodyB = GetBody(colliderB.GetBodyRef());
-
-					if (bodyA.GetBodyType() == BodyType::Dynamic || bodyB.GetBodyType() == BodyType::Dynamic)
+					else
 					{
-						onCollision(collider.A, collider.B);
+						_contactListener->OnCollisionStay(collider.A, collider.B);
 					}
 				}
 			}
+
+			// The solver handles a contact from its first step, the resolver from its second one
+			if (isTrigger || (isNew && !_contactSolver.IsEnabled())) continue;
+
+			addContact(collider);
+		}
+
+		if (_contactSolver.IsEnabled())
+		{
+			solveContacts();
+		}
+		else
+		{
+			resolveContacts();
 		}
 
 		if (_contactListener != nullptr)
@@ -179,7 +391,7 @@ namespace Physics
 			// Exit
 			for (auto& colliderPair: _lastColliderPairs)
 			{
-				if (std::find(newColliderPairs.begin(), newColliderPairs.end(), colliderPair) != newColliderPairs.end()) continue;
+				if (_newColliderPairSet.Contains(colliderPair)) continue;
 
 				Collider& colliderA = GetCollider(colliderPair.A);
 				Collider& colliderB = GetCollider(colliderPair.B);
@@ -195,7 +407,142 @@ namespace Physics
 			}
 		}
 
-		_lastColliderPairs = newColliderPairs;
+		// The new pairs become the last ones, copied out of the frame allocator
+		_lastColliderPairs = _newColliderPairs;
+		std::swap(_lastColliderPairSet, _newColliderPairSet);
+	}
+
+	void World::addContact(const ColliderPair& colliderPair) noexcept
+	{
+		auto& bodyA = GetBody(GetCollider(colliderPair.A).GetBodyRef());
+		auto& bodyB = GetBody(GetCollider(colliderPair.B).GetBodyRef());
+		const auto isDynamicA = bodyA.GetBodyType() == BodyType::Dynamic;
+		const auto isDynamicB = bodyB.GetBodyType() == BodyType::Dynamic;
+
+		// Nothing to resolve between bodies that are not moving
+		if (!((isDynamicA && bodyA.IsAwake()) || (isDynamicB && bodyB.IsAwake()))) return;
+
+		// A moving body pushes a sleeping one, wake it up before moving it
+		if (isDynamicA) bodyA.WakeUp();
+		if (isDynamicB) bodyB.WakeUp();
+
+		if (_jobSystem != nullptr || _contactSolver.IsEnabled())
+		{
+			_contacts.push_back(colliderPair);
+		}
+		else
+		{
+			onCollision(colliderPair.A, colliderPair.B);
+		}
+	}
+
+	void World::resolveContacts() noexcept
+	{
+		if (_contacts.empty()) return;
+
+#ifdef TRACY_ENABLE
+		ZoneNamedN(resolveContacts, "World::resolveContacts", true);
+#endif
+		PROFILE_SCOPE(contactsProfile, "World::contacts");
+
+		static constexpr std::size_t MAX_COLORS = 64;
+
+		_bodyColors.assign(_bodies.size(), 0);
+		_contactColors.resize(_contacts.size());
+		_colorOffsets.assign(MAX_COLORS + 1, 0);
+
+		// Give each contact the first color not used by its dynamic bodies, contacts over the last color are resolved one by one
+		for (std::size_t i = 0; i < _contacts.size(); i++)
+		{
+			const auto bodyRefA = GetCollider(_contacts[i].A).GetBodyRef();
+			const auto bodyRefB = GetCollider(_contacts[i].B).GetBodyRef();
+			const auto isDynamicA = GetBody(bodyRefA).GetBodyType() == BodyType::Dynamic;
+			const auto isDynamicB = GetBody(bodyRefB).GetBodyType() == BodyType::Dynamic;
+			const auto usedColors = (isDynamicA ? _bodyColors[bodyRefA.Index] : 0) | (isDynamicB ? _bodyColors[bodyRefB.Index] : 0);
+			const auto color = static_cast<std::size_t>(std::countr_one(usedColors));
+
+			_contactColors[i] = color;
+			_colorOffsets[color]++;
+
+			if (color == MAX_COLORS) continue;
+
+			if (isDynamicA) _bodyColors[bodyRefA.Index] |= std::uint64_t{1} << color;
+			if (isDynamicB) _bodyColors[bodyRefB.Index] |= std::uint64_t{1} << color;
+		}
+
+		// Group the contacts by color, keeping their order
+		std::size_t offset = 0;
+
+		for (auto& colorOffset : _colorOffsets)
+		{
+			const auto count = colorOffset;
+
+			colorOffset = offset;
+			offset += count;
+		}
+
+		_coloredContacts.resize(_contacts.size());
+
+		for (std::size_t i = 0; i < _contacts.size(); i++)
+		{
+			_coloredContacts[_colorOffsets[_contactColors[i]]++] = _contacts[i];
+		}
+
+		// Resolve the colors in order, after the loop above each offset is the end of its color
+		std::size_t begin = 0;
+
+		for (std::size_t color = 0; color < MAX_COLORS; color++)
+		{
+			const auto end = _colorOffsets[color];
+
+			_jobSystem->ParallelFor(end - begin, 16, [this, begin](std::size_t rangeBegin, std::size_t rangeEnd)
+			{
+				for (auto i = begin + rangeBegin; i < begin + rangeEnd; i++)
+				{
+					onCollision(_coloredContacts[i].A, _coloredContacts[i].B);
+				}
+			});
+
+			begin = end;
+		}
+
+		for (auto i = begin; i < _coloredContacts.size(); i++)
+		{
+			onCollision(_coloredContacts[i].A, _coloredContacts[i].B);
+		}
+	}
+
+	void World::solveContacts() noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(solveContacts, "World::solveContacts", true);
+#endif
+		PROFILE_SCOPE(contactsProfile, "World::contacts");
+
+		_contactSolver.Clear();
+
+		for (const auto& contact : _contacts)
+		{
+			const auto& colliderA = GetCollider(contact.A);
+			const auto& colliderB = GetCollider(contact.B);
+			const auto bodyRefA = colliderA.GetBodyRef();
+			const auto bodyRefB = colliderB.GetBodyRef();
+			const auto& bodyA = GetBody(bodyRefA);
+			const auto& bodyB = GetBody(bodyRefB);
+			const auto manifold = ComputeManifold(colliderA, bodyA.Position(), colliderB, bodyB.Position());
+
+			// The bounds overlap but the shapes do not
+			if (manifold.PointCount == 0) continue;
+
+			// Same restitution as the contact resolver
+			const auto massA = bodyA.Mass();
+			const auto massB = bodyB.Mass();
+			const auto restitution = (massA * colliderA.GetRestitution() + massB * colliderB.GetRestitution()) / (massA + massB);
+
+			_contactSolver.AddContact(contact, bodyRefA.Index, bodyA, bodyRefB.Index, bodyB, manifold, restitution);
+		}
+
+		_contactSolver.Solve(_bodies);
 	}
 
 	void World::onCollision(Physics::ColliderRef colliderRef, Physics::ColliderRef otherColliderRef) noexcept
@@ -222,31 +569,33 @@ namespace Physics
 
 		if (colliderA.GetBodyRef() == colliderB.GetBodyRef()) return false;
 
+		// Shapes are translated by value, polygon vertices are read in place, so nothing here allocates
+		const auto translationA = colliderA.GetPosition() + colliderA.GetOffset();
+		const auto translationB = colliderB.GetPosition() + colliderB.GetOffset();
+
         switch (colliderA.GetShapeType())
         {
             case Math::ShapeType::Circle:
             {
-                auto circleA = Math::CircleF(colliderA.GetOffset() + colliderA.GetPosition(), colliderA.GetCircle().Radius());
+                const auto circleA = Math::CircleF(translationA, colliderA.GetCircle().Radius());
 
                 switch (colliderB.GetShapeType())
                 {
                     case Math::ShapeType::Circle:
                     {
-                        auto circleB = Math::CircleF(colliderB.GetOffset() + colliderB.GetPosition(), colliderB.GetCircle().Radius());
+                        const auto circleB = Math::CircleF(translationB, colliderB.GetCircle().Radius());
 
                         return Math::Intersect(circleA, circleB);
                     }
                     case Math::ShapeType::Rectangle:
                     {
-                        auto rectB = colliderB.GetRectangle() + colliderB.GetPosition() + colliderB.GetOffset();
+                        const auto rectB = colliderB.GetRectangle() + translationB;
 
                         return Math::Intersect(circleA, rectB);
                     }
                     case Math::ShapeType::Polygon:
                     {
-                        auto polyB = colliderB.GetPolygon() + colliderB.GetPosition() + colliderB.GetOffset();
-
-                        return Math::Intersect(circleA, polyB);
+                        return Math::Intersect(colliderB.GetPolygon().Vertices(), translationB, circleA);
                     }
 	                case Math::ShapeType::None:break;
                 }
@@ -255,27 +604,25 @@ namespace Physics
 
             case Math::ShapeType::Rectangle:
             {
-                auto rectA = colliderA.GetRectangle() + colliderA.GetPosition() + colliderA.GetOffset();
+                const auto rectA = colliderA.GetRectangle() + translationA;
 
                 switch (colliderB.GetShapeType())
                 {
                     case Math::ShapeType::Circle:
                     {
-                        auto circleB = Math::CircleF(colliderB.GetOffset() + colliderB.GetPosition(), colliderB.GetCircle().Radius());
+                        const auto circleB = Math::CircleF(translationB, colliderB.GetCircle().Radius());
 
                         return Math::Intersect(rectA, circleB);
                     }
                     case Math::ShapeType::Rectangle:
                     {
-                        auto rectB = colliderB.GetRectangle() + colliderB.GetPosition() + colliderB.GetOffset();
+                        const auto rectB = colliderB.GetRectangle() + translationB;
 
                         return Math::Intersect(rectA, rectB);
                     }
                     case Math::ShapeType::Polygon:
                     {
-                        auto polyB = colliderB.GetPolygon() + colliderB.GetPosition() + colliderB.GetOffset();
-
-                        return Math::Intersect(rectA, polyB);
+                        return Math::Intersect(colliderB.GetPolygon().Vertices(), translationB, rectA);
                     }
 	                case Math::ShapeType::None:break;
                 }
@@ -284,27 +631,25 @@ namespace Physics
 
             case Math::ShapeType::Polygon:
             {
-                auto polyA = colliderA.GetPolygon() + colliderA.GetPosition();
+                const auto verticesA = colliderA.GetPolygon().Vertices();
 
                 switch (colliderB.GetShapeType())
                 {
                     case Math::ShapeType::Circle:
                     {
-                        auto circleB = Math::CircleF(colliderB.GetOffset() + colliderB.GetPosition(), colliderB.GetCircle().Radius());
+                        const auto circleB = Math::CircleF(translationB, colliderB.GetCircle().Radius());
 
-                        return Math::Intersect(polyA, circleB);
+                        return Math::Intersect(verticesA, translationA, circleB);
                     }
                     case Math::ShapeType::Rectangle:
                     {
-                        auto rectB = colliderB.GetRectangle() + colliderB.GetPosition() + colliderB.GetOffset();
+                        const auto rectB = colliderB.GetRectangle() + translationB;
 
-                        return Math::Intersect(polyA, rectB);
+                        return Math::Intersect(verticesA, translationA, rectB);
                     }
                     case Math::ShapeType::Polygon:
                     {
-                        auto polyB = colliderB.GetPolygon() + colliderB.GetPosition() + colliderB.GetOffset();
-
-                        return Math::Intersect(polyA, polyB);
+                        return Math::Intersect(verticesA, translationA, colliderB.GetPolygon().Vertices(), translationB);
                     }
 	                case Math::ShapeType::None:break;
                 }
@@ -316,46 +661,386 @@ namespace Physics
 		return false;
 	}
 
-	void World::updateBodies(float deltaTime) noexcept
+	void World::integrateDynamicBodies(float deltaTime) noexcept
 	{
 #ifdef TRACY_ENABLE
-		ZoneNamedN(updateBodies, "World::updateBodies", true);
+		ZoneNamedN(integrateDynamicBodies, "World::integrateDynamicBodies", true);
 #endif
-		for (auto& body : _bodies)
+		static constexpr float MAX_VELOCITY_Y = 400.f;
+		static constexpr std::size_t LANES = 4;
+
+		const Math::FourVec2F gravity(_gravity);
+		const Math::FourVec2F maxVelocity(Math::Vec2F(std::numeric_limits<float>::max(), MAX_VELOCITY_Y));
+		const std::array<float, LANES> deltaTimes { deltaTime, deltaTime, deltaTime, deltaTime };
+
+		for (std::size_t i = 0; i < _dynamicBodies.size(); i += LANES)
 		{
-			if (!body.IsEnabled()) continue;
+			const auto count = std::min(LANES, _dynamicBodies.size() - i);
 
-			switch(body.GetBodyType())
+			// Gather the bodies in a structure of arrays, unused lanes stay at 0
+			std::array<float, LANES> positionsX {}, positionsY {};
+			std::array<float, LANES> velocitiesX {}, velocitiesY {};
+			std::array<float, LANES> forcesX {}, forcesY {};
+			std::array<float, LANES> inverseMasses {}, gravityMasses {};
+
+			for (std::size_t lane = 0; lane < count; lane++)
 			{
-				case BodyType::Static: break;
-				case BodyType::Dynamic:
+				const auto& body = _bodies[_dynamicBodies[i + lane]];
+
+				positionsX[lane] = body._position.X;
+				positionsY[lane] = body._position.Y;
+				velocitiesX[lane] = body._velocity.X;
+				velocitiesY[lane] = body._velocity.Y;
+				forcesX[lane] = body._force.X;
+				forcesY[lane] = body._force.Y;
+				inverseMasses[lane] = body._inverseMass;
+				gravityMasses[lane] = body._useGravity ? body._mass : 0.f;
+			}
+
+			const auto forces = Math::FourVec2F(forcesX, forcesY) + gravity * gravityMasses;
+			auto velocities = Math::FourVec2F(velocitiesX, velocitiesY) + forces * inverseMasses * deltaTimes;
+
+			// Clamp the velocity to a maximum value
+			velocities = Math::FourVec2F::Min(velocities, maxVelocity);
+
+			const auto positions = Math::FourVec2F(positionsX, positionsY) + velocities * deltaTimes;
+
+			// Scatter the results back to the bodies
+			for (std::size_t lane = 0; lane < count; lane++)
+			{
+				auto& body = _bodies[_dynamicBodies[i + lane]];
+
+				body._velocity = Math::Vec2F(velocities.X()[lane], velocities.Y()[lane]);
+				body._position = Math::Vec2F(positions.X()[lane], positions.Y()[lane]);
+				body._force = Math::Vec2F::Zero();
+			}
+		}
+	}
+
+	void World::collectSweptColliders() noexcept
+	{
+		// Count the colliders of each bullet, then place them after the ones of the previous bullets, in one pass over the colliders
+		_bulletColliderOffsets.assign(_bullets.size() + 1, 0);
+		_movingSweepTargets.clear();
+
+		const auto findBullet = [this](std::size_t bodyIndex)
+		{
+			return static_cast<std::size_t>(std::find(_bullets.begin(), _bullets.end(), bodyIndex) - _bullets.begin());
+		};
+
+		for (auto& collider : _colliders)
+		{
+			if (!collider.IsEnabled() || collider.IsTrigger()) continue;
+
+			const auto bodyIndex = collider.GetBodyRef().Index;
+
+			if (_bodies[bodyIndex]._isBullet)
+			{
+				const auto bullet = findBullet(bodyIndex);
+
+				if (bullet < _bullets.size()) _bulletColliderOffsets[bullet + 1]++;
+			}
+
+			if (!isStaticCollider(collider))
+			{
+				_movingSweepTargets.push_back(collider.GetColliderRef().Index);
+			}
+		}
+
+		for (std::size_t i = 1; i < _bulletColliderOffsets.size(); i++)
+		{
+			_bulletColliderOffsets[i] += _bulletColliderOffsets[i - 1];
+		}
+
+		_bulletColliders.resize(_bulletColliderOffsets.back());
+
+		// The targets are the colliders of the bullets and of the other moving bodies, the ones of the bullets are among them
+		for (const auto colliderIndex : _movingSweepTargets)
+		{
+			const auto bodyIndex = _colliders[colliderIndex].GetBodyRef().Index;
+
+			if (!_bodies[bodyIndex]._isBullet) continue;
+
+			const auto bullet = findBullet(bodyIndex);
+
+			if (bullet < _bullets.size()) _bulletColliders[_bulletColliderOffsets[bullet]++] = colliderIndex;
+		}
+
+		// The offsets moved to the end of their bullet, shift them back to the start
+		for (auto i = _bulletColliderOffsets.size() - 1; i > 0; i--)
+		{
+			_bulletColliderOffsets[i] = _bulletColliderOffsets[i - 1];
+		}
+
+		_bulletColliderOffsets[0] = 0;
+	}
+
+	void World::sweepBullets() noexcept
+	{
+		if (_bullets.empty()) return;
+
+#ifdef TRACY_ENABLE
+		ZoneNamedN(sweepBullets, "World::sweepBullets", true);
+#endif
+		static constexpr std::size_t MAX_SUB_STEPS = 4;
+
+		collectSweptColliders();
+
+		for (std::size_t i = 0; i < _bullets.size(); i++)
+		{
+			auto& body = _bodies[_bullets[i]];
+			auto position = _bulletStartPositions[i];
+			auto displacement = body._position - position;
+
+			if (displacement == Math::Vec2F::Zero()) continue;
+
+			const auto collidersBegin = _bulletColliders.begin() + static_cast<std::ptrdiff_t>(_bulletColliderOffsets[i]);
+			const auto collidersEnd = _bulletColliders.begin() + static_cast<std::ptrdiff_t>(_bulletColliderOffsets[i + 1]);
+
+			// The size of the smallest collider of the bullet
+			auto minSize = Math::Vec2F(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+
+			for (auto it = collidersBegin; it != collidersEnd; ++it)
+			{
+				const auto size = _colliders[*it].GetBounds().Size();
+
+				minSize = Math::Vec2F(std::min(minSize.X, size.X), std::min(minSize.Y, size.Y));
+			}
+
+			// A body moving less than half its size overlaps anything it went through, the discrete collisions handle it
+			if (collidersBegin == collidersEnd || (std::abs(displacement.X) < minSize.X / 2.f && std::abs(displacement.Y) < minSize.Y / 2.f)) continue;
+
+			// Share of the step already done, the moving targets are swept from where they are at that time
+			auto elapsed = 0.f;
+
+			for (std::size_t subStep = 0; subStep < MAX_SUB_STEPS && displacement != Math::Vec2F::Zero(); subStep++)
+			{
+				TimeOfImpact firstImpact;
+				// Rest of the displacement of the collider hit first during this step, zero for a static one
+				auto firstImpactTargetDisplacement = Math::Vec2F::Zero();
+
+				for (auto it = collidersBegin; it != collidersEnd; ++it)
 				{
-					if (body.UseGravity())
+					const auto& collider = _colliders[*it];
+					const auto startBounds = collider.GetBounds() + (position + collider.GetOffset() - collider.GetPosition());
+					const auto sweptBounds = getSweptBounds(startBounds, displacement);
+
+					_sweptPairs.clear();
+					_staticQuadTree.AddPossiblePairs({collider.GetColliderRef(), sweptBounds}, _sweptPairs);
+
+					for (const auto& pair : _sweptPairs)
+					{
+						const auto& target = GetCollider(pair.A == collider.GetColliderRef() ? pair.B : pair.A);
+
+						if (target.IsTrigger()) continue;
+
+						const auto timeOfImpact = ComputeTimeOfImpact(collider, position, displacement, target);
+
+						if (timeOfImpact.IsHit && timeOfImpact.Time < firstImpact.Time)
+						{
+							firstImpact = timeOfImpact;
+							firstImpactTargetDisplacement = Math::Vec2F::Zero();
+						}
+					}
+
+					// The moving targets are swept in their frame, their colliders are still where their body was before this step
+					for (const auto targetIndex : _movingSweepTargets)
 					{
-						body.AddForce(_gravity * body.Mass());
+						const auto& target = _colliders[targetIndex];
+
+						if (target.GetBodyRef().Index == _bullets[i]) continue;
+
+						const auto targetDisplacement = _bodies[target.GetBodyRef().Index]._position + target.GetOffset() - target.GetPosition();
+						const auto relativePosition = position - targetDisplacement * elapsed;
+						const auto relativeDisplacement = displacement - targetDisplacement * (1.f - elapsed);
+						const auto relativeBounds = collider.GetBounds() + (relativePosition + collider.GetOffset() - collider.GetPosition());
+
+						if (!Math::Intersect(getSweptBounds(relativeBounds, relativeDisplacement), target.GetBounds())) continue;
+
+						const auto timeOfImpact = ComputeTimeOfImpact(collider, relativePosition, relativeDisplacement, target);
+
+						if (timeOfImpact.IsHit && timeOfImpact.Time < firstImpact.Time)
+						{
+							firstImpact = timeOfImpact;
+							firstImpactTargetDisplacement = targetDisplacement * (1.f - elapsed);
+						}
 					}
+				}
+
+				if (!firstImpact.IsHit)
+				{
+					position += displacement;
+					break;
+				}
+
+				// Stop at the contact and keep the rest of the displacement along the surface, which keeps moving with its body
+				const auto targetDisplacement = firstImpactTargetDisplacement * (1.f - firstImpact.Time);
+				auto relativeDisplacement = (displacement - firstImpactTargetDisplacement) * (1.f - firstImpact.Time);
+
+				position += displacement * firstImpact.Time;
+				elapsed += (1.f - elapsed) * firstImpact.Time;
+
+				const auto intoSurface = relativeDisplacement.Dot(firstImpact.Normal);
+
+				if (intoSurface < 0.f)
+				{
+					relativeDisplacement -= firstImpact.Normal * intoSurface;
+				}
+
+				displacement = relativeDisplacement + targetDisplacement;
+			}
+
+			body._position = position;
+		}
+	}
+
+	Math::RectangleF World::getSweptBounds(const Math::RectangleF& bounds, Math::Vec2F displacement) noexcept
+	{
+		const auto endBounds = bounds + displacement;
+
+		return {
+			Math::Vec2F(std::min(bounds.Left(), endBounds.Left()), std::min(bounds.Bottom(), endBounds.Bottom())),
+			Math::Vec2F(std::max(bounds.Right(), endBounds.Right()), std::max(bounds.Top(), endBounds.Top()))
+		};
+	}
+
+	std::size_t World::findIsland(std::size_t bodyIndex) noexcept
+	{
+		while (_islandParents[bodyIndex] != bodyIndex)
+		{
+			// Path halving, keeps the trees flat
+			_islandParents[bodyIndex] = _islandParents[_islandParents[bodyIndex]];
+			bodyIndex = _islandParents[bodyIndex];
+		}
+
+		return bodyIndex;
+	}
+
+	void World::updateSleep() noexcept
+	{
+		if (_sleepFrames == 0) return;
+
+#ifdef TRACY_ENABLE
+		ZoneNamedN(updateSleep, "World::updateSleep", true);
+#endif
+		const auto sleepVelocity = _sleepVelocity * _sleepVelocity;
+
+		for (auto& body : _bodies)
+		{
+			if (!body.IsEnabled() || body._bodyType != BodyType::Dynamic || !body._isAwake) continue;
+
+			if (body._velocity.SquareLength() < sleepVelocity)
+			{
+				if (body._restFrames < _sleepFrames) body._restFrames++;
+			}
+			else
+			{
+				body._restFrames = 0;
+			}
+		}
+
+		_islandParents.resize(_bodies.size());
+
+		for (std::size_t i = 0; i < _islandParents.size(); i++)
+		{
+			_islandParents[i] = i;
+		}
+
+		// The pairs of this step, dynamic bodies colliding with each other are in the same island
+		for (const auto& colliderPair : _lastColliderPairs)
+		{
+			const auto& colliderA = GetCollider(colliderPair.A);
+			const auto& colliderB = GetCollider(colliderPair.B);
+
+			if (colliderA.IsTrigger() || colliderB.IsTrigger()) continue;
+
+			const auto bodyIndexA = colliderA.GetBodyRef().Index;
+			const auto bodyIndexB = colliderB.GetBodyRef().Index;
+
+			if (_bodies[bodyIndexA]._bodyType != BodyType::Dynamic || _bodies[bodyIndexB]._bodyType != BodyType::Dynamic) continue;
+
+			_islandParents[findIsland(bodyIndexA)] = findIsland(bodyIndexB);
+		}
+
+		_islandCanSleep.assign(_bodies.size(), 1);
+
+		for (std::size_t i = 0; i < _bodies.size(); i++)
+		{
+			const auto& body = _bodies[i];
+
+			if (!body.IsEnabled() || body._bodyType != BodyType::Dynamic) continue;
+
+			if (body._isAwake && body._restFrames < _sleepFrames)
+			{
+				_islandCanSleep[findIsland(i)] = 0;
+			}
+		}
+
+		for (std::size_t i = 0; i < _bodies.size(); i++)
+		{
+			auto& body = _bodies[i];
+
+			if (!body.IsEnabled() || body._bodyType != BodyType::Dynamic) continue;
+
+			if (_islandCanSleep[findIsland(i)])
+			{
+				if (body._isAwake) body.Sleep();
+			}
+			else if (!body._isAwake)
+			{
+				body.WakeUp();
+			}
+		}
+	}
+
+	void World::updateBodies(float deltaTime) noexcept
+	{
+#ifdef TRACY_ENABLE
+		ZoneNamedN(updateBodies, "World::updateBodies", true);
+#endif
+		PROFILE_SCOPE(updateBodiesProfile, "World::updateBodies");
+
+		_dynamicBodies.clear();
+		_bullets.clear();
+		_bulletStartPositions.clear();
 
-					static constexpr float MAX_VELOCITY_Y = 400.f;
+		for (std::size_t i = 0; i < _bodies.size(); i++)
+		{
+			auto& body = _bodies[i];
 
-					body.AddVelocity(body.Force() * body.InverseMass() * deltaTime);
+			if (body._mass < 0.f) continue;
 
-					// Clamp the velocity to a maximum value
-					body.SetVelocity({ body.Velocity().X, std::min(body.Velocity().Y, MAX_VELOCITY_Y) });
+			switch(body._bodyType)
+			{
+				case BodyType::Static: break;
+				case BodyType::Dynamic:
+				{
+					if (body._isAwake)
+					{
+						_dynamicBodies.push_back(i);
 
-					body.AddPosition(body.Velocity() * deltaTime);
-					body.SetForce(Math::Vec2F(0, 0));
+						if (body._isBullet)
+						{
+							_bullets.push_back(i);
+							_bulletStartPositions.push_back(body._position);
+						}
+					}
 				}
 				break;
 				case BodyType::Kinematic:
 				{
-					body.AddPosition(body.Velocity() * deltaTime);
+					body._position += body._velocity * deltaTime;
 				}
 				break;
 			}
 		}
 
+		integrateDynamicBodies(deltaTime);
+
 		if (_colliders.empty()) return;
 
+		sweepBullets();
+
 		for (auto& collider : _colliders)
 		{
 			if (!collider.IsEnabled()) continue;
@@ -371,8 +1056,13 @@ namespace Physics
 #ifdef TRACY_ENABLE
 		ZoneNamedN(update, "World::Update", true);
 #endif
+		PROFILE_SCOPE(updateProfile, "World::Update");
+
+		clearFrameAllocator();
+
 		updateBodies(deltaTime);
         updateColliders();
+        updateSleep();
 	}
 
 	BodyRef World::CreateBody() noexcept
@@ -429,6 +1119,16 @@ namespace Physics
 		return _bodies[bodyRef.Index];
 	}
 
+	const Body& World::GetBody(BodyRef bodyRef) const
+	{
+		if (_bodyGenerations[bodyRef.Index] != bodyRef.Generation)
+		{
+			throw InvalidBodyRefException();
+		}
+
+		return _bodies[bodyRef.Index];
+	}
+
 	ColliderRef World::CreateCollider(BodyRef bodyRef) noexcept
 	{
 		for (size_t i = 0; i < _colliders.size(); i++)
@@ -461,6 +1161,7 @@ namespace Physics
 
 	void World::DestroyCollider(ColliderRef colliderRef)
 	{
+		_staticQuadTree.Remove(colliderRef);
 		_colliders[colliderRef.Index].Free();
 		_colliderGenerations[colliderRef.Index]++;
 	}
@@ -475,6 +1176,16 @@ namespace Physics
 		return _colliders[colliderRef.Index];
 	}
 
+	const Collider& World::GetCollider(ColliderRef colliderRef) const
+	{
+		if (_colliderGenerations[colliderRef.Index] != colliderRef.Generation)
+		{
+			throw InvalidColliderRefException();
+		}
+
+		return _colliders[colliderRef.Index];
+	}
+
     void World::SetContactListener(ContactListener* contactListener) noexcept
     {
         _contactListener = contactListener;
@@ -482,11 +1193,45 @@ namespace Physics
 
 	std::vector<Math::RectangleF> World::GetQuadTreeBoundaries() const noexcept
 	{
-		return _quadTree.GetBoundaries();
+		auto boundaries = _quadTree.GetBoundaries();
+		const auto staticBoundaries = _staticQuadTree.GetBoundaries();
+
+		boundaries.insert(boundaries.end(), staticBoundaries.begin(), staticBoundaries.end());
+
+		return boundaries;
 	}
 
     void World::SetGravity(Math::Vec2F gravity) noexcept
     {
         _gravity = gravity;
     }
+
+	void World::SetThreadCount(std::size_t threadCount) noexcept
+	{
+		if (threadCount == 0)
+		{
+			_jobSystem = nullptr;
+			return;
+		}
+
+		_jobSystem = std::make_shared<JobSystem>(threadCount);
+	}
+
+	void World::SetSolverIterations(std::size_t velocityIterations, std::size_t positionIterations) noexcept
+	{
+		_contactSolver.SetIterations(velocityIterations, positionIterations);
+	}
+
+	void World::SetSleepThreshold(float velocity, std::uint32_t frameCount) noexcept
+	{
+		_sleepVelocity = velocity;
+		_sleepFrames = frameCount;
+
+		if (frameCount != 0) return;
+
+		for (auto& body : _bodies)
+		{
+			body.WakeUp();
+		}
+	}
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "MemoryTracker.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Counts the heap allocations of a test executable, to check that the steps of the engine do not allocate.
+ * Include it in a single file of an executable, it replaces the global operator new.
+ *
+ * The allocators of the engine are counted through the MemoryTracker, the other allocations through operator new.
+ * The sanitizers replace operator new themselves, so only the allocators of the engine are counted under them.
+ */
+
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define ALLOCATION_COUNTER_SANITIZED
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define ALLOCATION_COUNTER_SANITIZED
+#endif
+#endif
+
+#ifdef ALLOCATION_COUNTER_SANITIZED
+constexpr bool IS_NEW_COUNTED = false;
+#else
+constexpr bool IS_NEW_COUNTED = true;
+#endif
+
+static std::atomic<bool> isCountingAllocations { false };
+static std::atomic<std::size_t> newAllocationCount { 0 };
+
+#ifndef ALLOCATION_COUNTER_SANITIZED
+/**
+ * @brief Allocate for every operator new, the plain and the array ones, with their default or a bigger alignment
+ */
+static void* CountedAllocate(std::size_t size, std::size_t alignment)
+{
+	if (isCountingAllocations) newAllocationCount++;
+
+	if (size == 0) size = 1;
+
+	void* pointer;
+
+	if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) pointer = std::malloc(size);
+#ifdef _MSC_VER
+	else pointer = _aligned_malloc(size, alignment);
+#else
+	// The size of an aligned allocation is a multiple of its alignment
+	else pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+
+	if (pointer == nullptr) throw std::bad_alloc();
+
+	return pointer;
+}
+
+static void CountedFree(void* pointer, std::size_t alignment) noexcept
+{
+#ifdef _MSC_VER
+	if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	{
+		_aligned_free(pointer);
+
+		return;
+	}
+#endif
+	static_cast<void>(alignment);
+
+	std::free(pointer);
+}
+
+// Every replaceable form is replaced, so each allocation is freed by the function matching the one that allocated it
+void* operator new(std::size_t size) { return CountedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return CountedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return CountedAllocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return CountedAllocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* pointer) noexcept { CountedFree(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* pointer) noexcept { CountedFree(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void* pointer, std::size_t) noexcept { CountedFree(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* pointer, std::size_t) noexcept { CountedFree(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void* pointer, std::align_val_t alignment) noexcept { CountedFree(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept { CountedFree(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept { CountedFree(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept { CountedFree(pointer, static_cast<std::size_t>(alignment)); }
+#endif
+
+/**
+ * @brief Allocations made by the allocators of the engine since the start, in every subsystem
+ */
+static std::uint64_t TrackedAllocationCount() noexcept
+{
+	std::uint64_t allocations = 0;
+
+	for (std::size_t tag = 0; tag < static_cast<std::size_t>(MemoryTag::COUNT); tag++)
+	{
+		allocations += MemoryTracker::GetStatistics(static_cast<MemoryTag>(tag)).Allocations;
+	}
+
+	return allocations;
+}
+
+/**
+ * @brief Count the heap allocations made by a function
+ */
+template <typename Function>
+static std::size_t CountAllocations(Function function)
+{
+	const auto trackedAllocationsBefore = TrackedAllocationCount();
+
+	newAllocationCount = 0;
+	isCountingAllocations = true;
+	function();
+	isCountingAllocations = false;
+
+	return newAllocationCount + static_cast<std::size_t>(TrackedAllocationCount() - trackedAllocationsBefore);
+}
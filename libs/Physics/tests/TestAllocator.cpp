@@ -0,0 +1,264 @@
+#include "Allocator.h"
+#include "World.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+
+TEST(PoolAllocator, AllocateAllBlocks)
+{
+	constexpr std::size_t blockSize = 32;
+	constexpr std::size_t blockCount = 4;
+
+	alignas(std::max_align_t) std::uint8_t buffer[blockSize * blockCount];
+	PoolAllocator poolAllocator(buffer, sizeof(buffer), blockSize);
+
+	void* blocks[blockCount];
+
+	for (auto& block : blocks)
+	{
+		block = poolAllocator.Allocate(blockSize, 8);
+
+		ASSERT_NE(block, nullptr);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t), 0);
+	}
+
+	EXPECT_EQ(poolAllocator.Allocate(blockSize, 8), nullptr);
+	EXPECT_EQ(poolAllocator.GetAllocations(), blockCount);
+
+	// A block given back is the next one given
+	poolAllocator.Deallocate(blocks[1]);
+
+	EXPECT_EQ(poolAllocator.Allocate(blockSize, 8), blocks[1]);
+
+	poolAllocator.Clear();
+
+	EXPECT_EQ(poolAllocator.GetAllocations(), 0);
+
+	for (std::size_t i = 0; i < blockCount; i++)
+	{
+		EXPECT_NE(poolAllocator.Allocate(blockSize, 8), nullptr);
+	}
+
+	EXPECT_EQ(poolAllocator.Allocate(blockSize, 8), nullptr);
+}
+
+TEST(FrameAllocator, GrowsToFitAStep)
+{
+	FrameAllocator frameAllocator(64);
+
+	EXPECT_EQ(frameAllocator.GetCapacity(), 64);
+
+	// More than the buffer, the rest goes on the heap until the next clear
+	for (int i = 0; i < 8; i++)
+	{
+		EXPECT_NE(frameAllocator.Allocate(32, 8), nullptr);
+	}
+
+	frameAllocator.Clear();
+
+	const auto capacity = frameAllocator.GetCapacity();
+
+	EXPECT_GE(capacity, 8 * 32);
+
+	// The same step again fits in the buffer, which does not grow anymore
+	for (int i = 0; i < 8; i++)
+	{
+		EXPECT_NE(frameAllocator.Allocate(32, 8), nullptr);
+	}
+
+	frameAllocator.Clear();
+
+	EXPECT_EQ(frameAllocator.GetCapacity(), capacity);
+	EXPECT_EQ(frameAllocator.GetAllocations(), 0);
+}
+
+TEST(FrameAllocator, Vector)
+{
+	FrameAllocator frameAllocator;
+
+	for (int step = 0; step < 3; step++)
+	{
+		MyVector<int> vector{StandardAllocator<int> {frameAllocator}};
+
+		for (int i = 0; i < 100; i++)
+		{
+			vector.push_back(i);
+		}
+
+		EXPECT_EQ(vector[99], 99);
+
+		vector = MyVector<int>(vector.get_allocator());
+		frameAllocator.Clear();
+	}
+
+	EXPECT_GE(frameAllocator.GetCapacity(), 100 * sizeof(int));
+}
+
+TEST(FrameAllocator, CopyHasItsOwnBuffer)
+{
+	FrameAllocator frameAllocator(128);
+	FrameAllocator copy(frameAllocator);
+
+	EXPECT_EQ(copy.GetCapacity(), frameAllocator.GetCapacity());
+
+	auto* ptr = frameAllocator.Allocate(16, 8);
+	auto* copyPtr = copy.Allocate(16, 8);
+
+	EXPECT_NE(ptr, copyPtr);
+	EXPECT_FALSE(StandardAllocator<int>(frameAllocator) == StandardAllocator<int>(copy));
+}
+
+TEST(MemoryTracker, HeapAllocatorTag)
+{
+	HeapAllocator heapAllocator(MemoryTag::Network);
+	HeapAllocator untaggedAllocator;
+
+	const auto before = MemoryTracker::GetStatistics(MemoryTag::Network);
+
+	auto* ptr = heapAllocator.Allocate(100, 8);
+	auto* otherPtr = heapAllocator.Allocate(50, 8);
+
+	auto statistics = MemoryTracker::GetStatistics(MemoryTag::Network);
+
+	EXPECT_EQ(statistics.LiveBytes, before.LiveBytes + 150);
+	EXPECT_EQ(statistics.LiveAllocations, before.LiveAllocations + 2);
+	EXPECT_EQ(statistics.Allocations, before.Allocations + 2);
+	EXPECT_GE(statistics.PeakBytes, before.LiveBytes + 150);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t), 0);
+
+	// Deallocated by another heap allocator, counted back in the tag of the allocation
+	untaggedAllocator.Deallocate(ptr);
+	heapAllocator.Deallocate(otherPtr);
+
+	statistics = MemoryTracker::GetStatistics(MemoryTag::Network);
+
+	EXPECT_EQ(statistics.LiveBytes, before.LiveBytes);
+	EXPECT_EQ(statistics.LiveAllocations, before.LiveAllocations);
+	EXPECT_GE(statistics.PeakBytes, before.LiveBytes + 150);
+
+	MemoryTracker::ResetPeaks();
+
+	EXPECT_EQ(MemoryTracker::GetStatistics(MemoryTag::Network).PeakBytes, before.LiveBytes);
+}
+
+TEST(MemoryTracker, WorldTags)
+{
+	const auto physicsBefore = MemoryTracker::GetStatistics(MemoryTag::Physics).LiveBytes;
+	const auto quadTreeBefore = MemoryTracker::GetStatistics(MemoryTag::QuadTree).LiveBytes;
+
+	{
+		Physics::World world;
+		const auto bodyRef = world.CreateBody();
+		world.GetCollider(world.CreateCollider(bodyRef)).SetCircle(Math::CircleF(Math::Vec2F::Zero(), 1.f));
+		world.Update(1.f / 30.f);
+
+		EXPECT_GT(MemoryTracker::GetStatistics(MemoryTag::Physics).LiveBytes, physicsBefore);
+		EXPECT_GT(MemoryTracker::GetStatistics(MemoryTag::QuadTree).LiveBytes, quadTreeBefore);
+	}
+
+	EXPECT_EQ(MemoryTracker::GetStatistics(MemoryTag::Physics).LiveBytes, physicsBefore);
+	EXPECT_EQ(MemoryTracker::GetStatistics(MemoryTag::QuadTree).LiveBytes, quadTreeBefore);
+}
+
+TEST(MemoryTracker, Export)
+{
+	const auto json = MemoryTracker::ToJson();
+
+	EXPECT_EQ(json.front(), '{');
+	EXPECT_EQ(json.back(), '}');
+	EXPECT_NE(json.find("\"rollback\":{\"live_bytes\":"), std::string::npos);
+
+	const auto prometheus = MemoryTracker::ToPrometheus();
+
+	EXPECT_NE(prometheus.find("# TYPE memory_live_bytes gauge\n"), std::string::npos);
+	EXPECT_NE(prometheus.find("memory_allocations_total{tag=\"physics\"} "), std::string::npos);
+}
+
+TEST(ThreadCacheAllocator, ReusesBlocks)
+{
+	HeapAllocator heapAllocator;
+	ThreadCacheAllocator threadCacheAllocator(heapAllocator, MemoryTag::Rollback);
+
+	const auto before = MemoryTracker::GetStatistics(MemoryTag::Rollback);
+
+	auto* ptr = threadCacheAllocator.Allocate(100, 8);
+
+	// Counted with the size of its block
+	EXPECT_EQ(MemoryTracker::GetStatistics(MemoryTag::Rollback).LiveBytes, before.LiveBytes + 128);
+
+	threadCacheAllocator.Deallocate(ptr);
+
+	EXPECT_EQ(MemoryTracker::GetStatistics(MemoryTag::Rollback).LiveBytes, before.LiveBytes);
+
+	// Same size class, the cached block is given back
+	EXPECT_EQ(threadCacheAllocator.Allocate(120, 8), ptr);
+
+	threadCacheAllocator.Deallocate(ptr);
+
+	// Bigger than the cached blocks
+	auto* bigPtr = threadCacheAllocator.Allocate(10'000, 8);
+
+	EXPECT_NE(bigPtr, nullptr);
+	EXPECT_EQ(MemoryTracker::GetStatistics(MemoryTag::Rollback).LiveBytes, before.LiveBytes + 10'000);
+
+	threadCacheAllocator.Deallocate(bigPtr);
+	threadCacheAllocator.Trim();
+}
+
+TEST(ThreadCacheAllocator, Threads)
+{
+	constexpr int threadCount = 4;
+	constexpr int allocationCount = 10'000;
+
+	HeapAllocator heapAllocator;
+	ThreadCacheAllocator threadCacheAllocator(heapAllocator, MemoryTag::Rollback);
+
+	const auto before = MemoryTracker::GetStatistics(MemoryTag::Rollback);
+
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < threadCount; t++)
+	{
+		threads.emplace_back([&threadCacheAllocator, t]()
+		{
+			MyVector<int> vector{StandardAllocator<int> {threadCacheAllocator}};
+			std::vector<void*> ptrs;
+
+			for (int i = 0; i < allocationCount; i++)
+			{
+				vector.push_back(i);
+
+				auto* ptr = threadCacheAllocator.Allocate(static_cast<std::size_t>(8 + (i * 7 + t) % 1000), 8);
+				*static_cast<int*>(ptr) = i;
+				ptrs.push_back(ptr);
+
+				if (ptrs.size() > 32)
+				{
+					threadCacheAllocator.Deallocate(ptrs.front());
+					ptrs.erase(ptrs.begin());
+				}
+			}
+
+			for (auto* ptr : ptrs)
+			{
+				threadCacheAllocator.Deallocate(ptr);
+			}
+
+			EXPECT_EQ(vector.back(), allocationCount - 1);
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	const auto statistics = MemoryTracker::GetStatistics(MemoryTag::Rollback);
+
+	EXPECT_EQ(statistics.LiveBytes, before.LiveBytes);
+	EXPECT_EQ(statistics.LiveAllocations, before.LiveAllocations);
+	EXPECT_GT(statistics.Allocations, before.Allocations + threadCount * allocationCount);
+}
@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 
 using namespace Physics;
@@ -119,7 +120,7 @@ TEST(Collider, SetPolygon)
 	collider.SetPolygon(polygon);
 
 	EXPECT_EQ(collider.GetShapeType(), ShapeType::Polygon);
-	EXPECT_EQ(collider.GetPolygon().Vertices(), polygon.Vertices());
+	EXPECT_TRUE(std::ranges::equal(collider.GetPolygon().Vertices(), polygon.Vertices()));
 }
 
 TEST(ColliderPair, DefaultConstructor)
@@ -0,0 +1,75 @@
+#include "ColliderPairSet.h"
+
+#include <gtest/gtest.h>
+
+TEST(ColliderPairSet, InsertAndContains)
+{
+	HeapAllocator allocator;
+	Physics::ColliderPairSet pairSet(allocator);
+
+	EXPECT_EQ(pairSet.Size(), 0);
+	EXPECT_FALSE(pairSet.Contains({{0, 0}, {1, 0}}));
+
+	EXPECT_TRUE(pairSet.Insert({{0, 0}, {1, 0}}));
+	EXPECT_FALSE(pairSet.Insert({{0, 0}, {1, 0}}));
+	// The order of the colliders does not matter
+	EXPECT_FALSE(pairSet.Insert({{1, 0}, {0, 0}}));
+
+	EXPECT_EQ(pairSet.Size(), 1);
+	EXPECT_TRUE(pairSet.Contains({{1, 0}, {0, 0}}));
+	// Same indices but another generation is another pair
+	EXPECT_FALSE(pairSet.Contains({{0, 1}, {1, 0}}));
+
+	pairSet.Clear();
+
+	EXPECT_EQ(pairSet.Size(), 0);
+	EXPECT_FALSE(pairSet.Contains({{0, 0}, {1, 0}}));
+}
+
+TEST(ColliderPairSet, ManyPairs)
+{
+	HeapAllocator allocator;
+	Physics::ColliderPairSet pairSet(allocator);
+
+	for (std::size_t i = 0; i < 100; i++)
+	{
+		for (std::size_t j = i + 1; j < 100; j++)
+		{
+			EXPECT_TRUE(pairSet.Insert({{i, 0}, {j, 0}}));
+		}
+	}
+
+	EXPECT_EQ(pairSet.Size(), 100 * 99 / 2);
+
+	for (std::size_t i = 0; i < 100; i++)
+	{
+		for (std::size_t j = 0; j < 100; j++)
+		{
+			EXPECT_EQ(pairSet.Contains({{i, 0}, {j, 0}}), i != j);
+		}
+	}
+}
+
+TEST(ColliderPairSet, FindIndex)
+{
+	HeapAllocator allocator;
+	Physics::ColliderPairSet pairSet(allocator);
+
+	EXPECT_EQ(pairSet.Find({{0, 0}, {1, 0}}), nullptr);
+
+	// Enough pairs to rehash, the indices must follow their pairs
+	for (std::size_t i = 0; i < 50; i++)
+	{
+		EXPECT_TRUE(pairSet.Insert({{i, 0}, {i + 1, 0}}, i * 10));
+	}
+
+	for (std::size_t i = 0; i < 50; i++)
+	{
+		const auto* index = pairSet.Find({{i + 1, 0}, {i, 0}});
+
+		ASSERT_NE(index, nullptr);
+		EXPECT_EQ(*index, i * 10);
+	}
+
+	EXPECT_EQ(pairSet.Find({{0, 0}, {2, 0}}), nullptr);
+}
@@ -0,0 +1,146 @@
+#include "Fixed.h"
+#include "Vec2.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace Math;
+
+TEST(Fixed, Arithmetic)
+{
+	EXPECT_EQ(Fixed16(1.5f) + Fixed16(2), Fixed16(3.5f));
+	EXPECT_EQ(Fixed16(1.5f) - Fixed16(2), Fixed16(-0.5f));
+	EXPECT_EQ(Fixed16(1.5f) * Fixed16(2), Fixed16(3));
+	EXPECT_EQ(Fixed16(3) / Fixed16(2), Fixed16(1.5f));
+	EXPECT_EQ(Fixed16(-7) % Fixed16(2), Fixed16(-1));
+	EXPECT_EQ(-Fixed16(2), Fixed16(-2));
+
+	EXPECT_LT(Fixed16(-1), Fixed16(0.5f));
+	EXPECT_EQ(Fixed16(-1.5f).Floor(), -2);
+	EXPECT_FLOAT_EQ(static_cast<float>(Fixed16(0.25f)), 0.25f);
+	EXPECT_EQ(Fixed16(1).Raw(), 1 << 16);
+#ifdef __SIZEOF_INT128__
+	EXPECT_EQ(Fixed32(1).Raw(), std::int64_t { 1 } << 32);
+#endif
+
+	EXPECT_THROW(static_cast<void>(Fixed16(1) / Fixed16(0)), DivisionByZeroException);
+}
+
+TEST(Fixed, Sqrt)
+{
+	EXPECT_EQ(Sqrt(Fixed16(9)), Fixed16(3));
+	EXPECT_EQ(Sqrt(Fixed16(-1)), Fixed16(0));
+	EXPECT_NEAR(static_cast<double>(Sqrt(Fixed16(2))), std::sqrt(2.0), 1.0 / 65536.0);
+#ifdef __SIZEOF_INT128__
+	EXPECT_NEAR(static_cast<double>(Sqrt(Fixed32(2))), std::sqrt(2.0), 1e-9);
+	EXPECT_NEAR(static_cast<double>(Sqrt(Fixed32(1000000))), 1000.0, 1e-9);
+#endif
+}
+
+TEST(Fixed, Trigonometry)
+{
+	for (const auto angle : { 0.0, 0.5, 1.0, 2.5, 3.14159, 4.0, 6.0, -1.0, -4.0, 10.0 })
+	{
+		EXPECT_NEAR(static_cast<double>(Sin(Fixed16(angle))), std::sin(angle), 1e-4);
+		EXPECT_NEAR(static_cast<double>(Cos(Fixed16(angle))), std::cos(angle), 1e-4);
+#ifdef __SIZEOF_INT128__
+		EXPECT_NEAR(static_cast<double>(Sin(Fixed32(angle))), std::sin(angle), 1e-4);
+		EXPECT_NEAR(static_cast<double>(Cos(Fixed32(angle))), std::cos(angle), 1e-4);
+#endif
+	}
+}
+
+TEST(Fixed, Vec2)
+{
+	const Vec2<Fixed16> vec(3, 4);
+
+	EXPECT_EQ(vec.Length(), Fixed16(5));
+	EXPECT_EQ(vec.SquareLength(), Fixed16(25));
+	EXPECT_EQ(vec.Dot(Vec2<Fixed16>::Up()), Fixed16(4));
+	EXPECT_EQ(vec.Normalized(), Vec2<Fixed16>(Fixed16(3) / Fixed16(5), Fixed16(4) / Fixed16(5)));
+	EXPECT_THROW(static_cast<void>(Vec2<Fixed16>::Zero().Normalized()), DivisionByZeroException);
+}
+
+/**
+ * @brief Simulate bodies bouncing in a box and pushed by recorded inputs, then hash their state
+ */
+template<typename T>
+static std::uint64_t RunReplay()
+{
+	constexpr int BodyCount = 8;
+	constexpr int TickCount = 600;
+
+	const T deltaTime = T(1) / T(30);
+	const T maxSpeed(20);
+	const T restitution(0.8f);
+	const Vec2<T> gravity(T(0), T(-9.81f));
+
+	Vec2<T> positions[BodyCount];
+	Vec2<T> velocities[BodyCount];
+
+	for (int i = 0; i < BodyCount; i++)
+	{
+		positions[i] = { T(10 + i * 10), T(50) };
+	}
+
+	std::uint32_t input = 12345;
+	std::uint64_t hash = 14695981039346656037ull;
+
+	for (int tick = 0; tick < TickCount; tick++)
+	{
+		// The input of the tick, an angle in hundredths of radian
+		input = input * 1664525u + 1013904223u;
+		const auto angle = T(static_cast<int>(input >> 16) % 628) / T(100);
+		const auto push = Vec2<T>(Cos(angle), Sin(angle)) * T(40);
+
+		for (int i = 0; i < BodyCount; i++)
+		{
+			auto& position = positions[i];
+			auto& velocity = velocities[i];
+
+			velocity += (i == tick % BodyCount ? gravity + push : gravity) * deltaTime;
+
+			if (velocity.Length() > maxSpeed)
+			{
+				velocity = velocity.Normalized() * maxSpeed;
+			}
+
+			position += velocity * deltaTime;
+
+			if (position.Y < 0)
+			{
+				position.Y = -position.Y;
+				velocity.Y = -velocity.Y * restitution;
+			}
+
+			if (position.X < 0 || position.X > T(100))
+			{
+				position.X = position.X < 0 ? -position.X : T(200) - position.X;
+				velocity.X = -velocity.X * restitution;
+			}
+
+			for (const auto raw : { position.X.Raw(), position.Y.Raw(), velocity.X.Raw(), velocity.Y.Raw() })
+			{
+				hash = (hash ^ static_cast<std::uint64_t>(raw)) * 1099511628211ull;
+			}
+		}
+	}
+
+	return hash;
+}
+
+// The hashes must be the same with every compiler flag, the build runs these tests again at -O0, -O3 and with -ffast-math.
+// Any change in them breaks the replays
+TEST(Determinism, FixedReplay16)
+{
+	EXPECT_EQ(RunReplay<Fixed16>(), 14028620242394112505ull);
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(Determinism, FixedReplay32)
+{
+	EXPECT_EQ(RunReplay<Fixed32>(), 4574208570759117072ull);
+}
+#endif
@@ -0,0 +1,210 @@
+#include "Manifold.h"
+#include "World.h"
+
+#include <gtest/gtest.h>
+
+using namespace Physics;
+using namespace Math;
+
+static constexpr float Tolerance = 0.0001f;
+
+static Collider MakeCircle(float radius)
+{
+	Collider collider;
+	collider.SetCircle(CircleF(radius));
+
+	return collider;
+}
+
+static Collider MakeRectangle(Vec2F minBound, Vec2F maxBound)
+{
+	Collider collider;
+	collider.SetRectangle(RectangleF(minBound, maxBound));
+
+	return collider;
+}
+
+static Collider MakeSquarePolygon(float halfSize, bool isClockwise = false)
+{
+	Collider collider;
+
+	if (isClockwise)
+	{
+		collider.SetPolygon(PolygonF({ {-halfSize, -halfSize}, {-halfSize, halfSize}, {halfSize, halfSize}, {halfSize, -halfSize} }));
+	}
+	else
+	{
+		collider.SetPolygon(PolygonF({ {-halfSize, -halfSize}, {halfSize, -halfSize}, {halfSize, halfSize}, {-halfSize, halfSize} }));
+	}
+
+	return collider;
+}
+
+TEST(Manifold, EdgeNormalsIgnoreWinding)
+{
+	const auto counterClockwise = MakeSquarePolygon(1.f);
+	const auto clockwise = MakeSquarePolygon(1.f, true);
+
+	ASSERT_EQ(counterClockwise.GetEdgeNormals().size(), 4);
+	ASSERT_EQ(clockwise.GetEdgeNormals().size(), 4);
+
+	EXPECT_EQ(counterClockwise.GetEdgeNormals()[0], Vec2F(0.f, -1.f));
+	EXPECT_EQ(counterClockwise.GetEdgeNormals()[1], Vec2F(1.f, 0.f));
+	EXPECT_EQ(clockwise.GetEdgeNormals()[0], Vec2F(-1.f, 0.f));
+	EXPECT_EQ(clockwise.GetEdgeNormals()[1], Vec2F(0.f, 1.f));
+}
+
+TEST(Manifold, Circles)
+{
+	const auto circleA = MakeCircle(1.f);
+	const auto circleB = MakeCircle(2.f);
+
+	const auto manifold = ComputeManifold(circleA, { 2.5f, 0.f }, circleB, Vec2F::Zero());
+
+	ASSERT_EQ(manifold.PointCount, 1);
+	EXPECT_NEAR(manifold.Normal.X, 1.f, Tolerance);
+	EXPECT_NEAR(manifold.Normal.Y, 0.f, Tolerance);
+	EXPECT_NEAR(manifold.Penetration, 0.5f, Tolerance);
+
+	EXPECT_EQ(ComputeManifold(circleA, { 3.5f, 0.f }, circleB, Vec2F::Zero()).PointCount, 0);
+}
+
+TEST(Manifold, Rectangles)
+{
+	const auto rectangleA = MakeRectangle({ -1.f, -1.f }, { 1.f, 1.f });
+	const auto rectangleB = MakeRectangle({ -2.f, -0.5f }, { 2.f, 0.5f });
+
+	// A is on top of B, sinking by 0.25
+	const auto manifold = ComputeManifold(rectangleA, { 0.5f, 1.25f }, rectangleB, Vec2F::Zero());
+
+	ASSERT_EQ(manifold.PointCount, 2);
+	EXPECT_EQ(manifold.Normal, Vec2F::Up());
+	EXPECT_NEAR(manifold.Penetration, 0.25f, Tolerance);
+	EXPECT_NEAR(manifold.Points[0].X, -0.5f, Tolerance);
+	EXPECT_NEAR(manifold.Points[1].X, 1.5f, Tolerance);
+
+	EXPECT_EQ(ComputeManifold(rectangleA, { 0.f, 2.f }, rectangleB, Vec2F::Zero()).PointCount, 0);
+}
+
+TEST(Manifold, Polygons)
+{
+	const auto polygonA = MakeSquarePolygon(1.f);
+	const auto polygonB = MakeSquarePolygon(2.f, true);
+
+	// A rests on B, sinking by 0.5
+	const auto manifold = ComputeManifold(polygonA, { 0.f, 2.5f }, polygonB, Vec2F::Zero());
+
+	ASSERT_EQ(manifold.PointCount, 2);
+	EXPECT_NEAR(manifold.Normal.X, 0.f, Tolerance);
+	EXPECT_NEAR(manifold.Normal.Y, 1.f, Tolerance);
+	EXPECT_NEAR(manifold.Penetration, 0.5f, Tolerance);
+
+	// The points lie in the overlap of the two polygons
+	for (std::size_t i = 0; i < manifold.PointCount; i++)
+	{
+		EXPECT_GE(manifold.Points[i].Y, 1.5f - Tolerance);
+		EXPECT_LE(manifold.Points[i].Y, 2.f + Tolerance);
+	}
+
+	// Swapping the colliders gives the opposite normal
+	const auto swapped = ComputeManifold(polygonB, Vec2F::Zero(), polygonA, { 0.f, 2.5f });
+
+	ASSERT_EQ(swapped.PointCount, 2);
+	EXPECT_NEAR(swapped.Normal.Y, -1.f, Tolerance);
+	EXPECT_NEAR(swapped.Penetration, 0.5f, Tolerance);
+
+	EXPECT_EQ(ComputeManifold(polygonA, { 3.1f, 0.f }, polygonB, Vec2F::Zero()).PointCount, 0);
+}
+
+TEST(Manifold, PolygonAndCircle)
+{
+	const auto polygon = MakeSquarePolygon(1.f);
+	const auto circle = MakeCircle(1.f);
+
+	// Face contact
+	const auto face = ComputeManifold(circle, { 1.5f, 0.f }, polygon, Vec2F::Zero());
+
+	ASSERT_EQ(face.PointCount, 1);
+	EXPECT_NEAR(face.Normal.X, 1.f, Tolerance);
+	EXPECT_NEAR(face.Penetration, 0.5f, Tolerance);
+
+	// Vertex contact, the normal goes from the corner to the center
+	const auto vertex = ComputeManifold(polygon, Vec2F::Zero(), circle, { 1.5f, 1.5f });
+
+	ASSERT_EQ(vertex.PointCount, 1);
+	EXPECT_NEAR(vertex.Normal.X, -std::sqrt(0.5f), Tolerance);
+	EXPECT_NEAR(vertex.Normal.Y, -std::sqrt(0.5f), Tolerance);
+	EXPECT_NEAR(vertex.Penetration, 1.f - std::sqrt(0.5f), Tolerance);
+
+	// Near the corner but out of reach
+	EXPECT_EQ(ComputeManifold(polygon, Vec2F::Zero(), circle, { 1.8f, 1.8f }).PointCount, 0);
+}
+
+TEST(Manifold, OffCenterCircle)
+{
+	Collider circle;
+	circle.SetCircle(CircleF({ 2.f, 0.f }, 1.f));
+	const auto polygon = MakeSquarePolygon(1.f);
+	const auto otherCircle = MakeCircle(1.f);
+
+	// The circle is drawn around position + center, at (3.5, 0), its body is at (1.5, 0)
+	const auto face = ComputeManifold(circle, { 1.5f, 0.f }, polygon, { 5.f, 0.f });
+
+	ASSERT_EQ(face.PointCount, 1);
+	EXPECT_NEAR(face.Normal.X, -1.f, Tolerance);
+	EXPECT_NEAR(face.Penetration, 0.5f, Tolerance);
+
+	const auto flipped = ComputeManifold(polygon, { 5.f, 0.f }, circle, { 1.5f, 0.f });
+
+	ASSERT_EQ(flipped.PointCount, 1);
+	EXPECT_NEAR(flipped.Normal.X, 1.f, Tolerance);
+	EXPECT_NEAR(flipped.Penetration, 0.5f, Tolerance);
+
+	const auto circles = ComputeManifold(circle, { 1.5f, 0.f }, otherCircle, { 5.f, 0.f });
+
+	ASSERT_EQ(circles.PointCount, 1);
+	EXPECT_NEAR(circles.Normal.X, -1.f, Tolerance);
+	EXPECT_NEAR(circles.Penetration, 0.5f, Tolerance);
+
+	// Around its body position, the circle would touch the square at the origin
+	EXPECT_EQ(ComputeManifold(circle, { 1.5f, 0.f }, polygon, Vec2F::Zero()).PointCount, 0);
+}
+
+TEST(Manifold, RectangleAndPolygon)
+{
+	const auto rectangle = MakeRectangle({ -1.f, -1.f }, { 1.f, 1.f });
+	Collider triangle;
+	triangle.SetPolygon(PolygonF({ {0.f, 0.f}, {2.f, 0.f}, {1.f, 2.f} }));
+
+	const auto manifold = ComputeManifold(triangle, { -1.f, 0.8f }, rectangle, Vec2F::Zero());
+
+	ASSERT_GE(manifold.PointCount, 1);
+	EXPECT_NEAR(manifold.Normal.X, 0.f, Tolerance);
+	EXPECT_NEAR(manifold.Normal.Y, 1.f, Tolerance);
+	EXPECT_NEAR(manifold.Penetration, 0.2f, Tolerance);
+}
+
+TEST(Manifold, PolygonFallsOnPolygon)
+{
+	World world;
+	world.SetGravity({ 0.f, -10.f });
+
+	const auto groundRef = world.CreateBody();
+	auto& ground = world.GetBody(groundRef);
+	ground.SetBodyType(BodyType::Static);
+	ground.SetUseGravity(false);
+	world.GetCollider(world.CreateCollider(groundRef)).SetPolygon(PolygonF({ {-5.f, -1.f}, {5.f, -1.f}, {5.f, 0.f}, {-5.f, 0.f} }));
+
+	const auto boxRef = world.CreateBody();
+	world.GetBody(boxRef).SetPosition({ 0.f, 2.f });
+	world.GetBody(boxRef).SetUseGravity(true);
+	world.GetCollider(world.CreateCollider(boxRef)).SetPolygon(PolygonF({ {-0.5f, 0.f}, {0.5f, 0.f}, {0.5f, 1.f}, {-0.5f, 1.f} }));
+
+	for (int i = 0; i < 300; i++)
+	{
+		world.Update(1.f / 60.f);
+	}
+
+	// The box lies on the ground instead of falling through it
+	EXPECT_NEAR(world.GetBody(boxRef).Position().Y, 0.f, 0.1f);
+}
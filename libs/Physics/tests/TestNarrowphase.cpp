@@ -0,0 +1,157 @@
+#include "World.h"
+#include "Body.h"
+
+#include "AllocationCounter.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace Physics;
+using namespace Math;
+
+TEST(Narrowphase, AllocationsAreCounted)
+{
+	HeapAllocator heapAllocator;
+
+	const auto count = CountAllocations([&]()
+	{
+		heapAllocator.Deallocate(heapAllocator.Allocate(16, 8));
+	});
+
+	EXPECT_EQ(count, 1);
+
+	if (!IS_NEW_COUNTED) return;
+
+	const auto newCount = CountAllocations([&]()
+	{
+		std::vector<int> values;
+		values.reserve(4);
+	});
+
+	EXPECT_EQ(newCount, 1);
+}
+
+TEST(Narrowphase, PolygonIntersectDoesNotAllocate)
+{
+	const PolygonF triangle({ {0.f, 0.f}, {2.f, 0.f}, {2.f, 2.f} });
+	const PolygonF square({ {1.f, 1.f}, {3.f, 1.f}, {3.f, 3.f}, {1.f, 3.f} });
+	const RectangleF rectangle({ 1.f, -1.f }, { 4.f, 0.5f });
+	const CircleF circle({ 2.5f, 0.f }, 1.f);
+	bool polygonIntersect = false, rectangleIntersect = false, circleIntersect = false, translatedIntersect = true;
+
+	const auto count = CountAllocations([&]()
+	{
+		const PolygonF copy = triangle + Vec2F(0.f, 0.f);
+
+		polygonIntersect = Intersect(copy, square);
+		rectangleIntersect = Intersect(triangle, rectangle);
+		circleIntersect = Intersect(circle, triangle);
+		translatedIntersect = Intersect(triangle.Vertices(), Vec2F(10.f, 0.f), square.Vertices(), Vec2F::Zero());
+	});
+
+	EXPECT_EQ(count, 0);
+	EXPECT_TRUE(polygonIntersect);
+	EXPECT_TRUE(rectangleIntersect);
+	EXPECT_TRUE(circleIntersect);
+	EXPECT_FALSE(translatedIntersect);
+}
+
+TEST(Narrowphase, PolygonTooManyVertices)
+{
+	EXPECT_THROW(PolygonF({ {0.f, 0.f}, {1.f, 0.f}, {2.f, 0.f}, {3.f, 0.f}, {4.f, 0.f}, {5.f, 0.f}, {6.f, 0.f}, {7.f, 0.f}, {8.f, 0.f} }), OutOfRangeException);
+}
+
+/**
+ * @brief Overlapping triggers of every shape, and solid bodies of every shape falling on a static ground,
+ * so every shape pair goes through the narrowphase and the contacts are resolved
+ */
+static void CreateNarrowphaseWorld(World& world)
+{
+	world.SetGravity(Vec2F(0.f, 10.f));
+
+	const auto setShape = [](Collider& collider, int shape)
+	{
+		switch (shape % 3)
+		{
+			case 0: collider.SetCircle(CircleF(1.f)); break;
+			case 1: collider.SetRectangle(RectangleF({ -1.f, -1.f }, { 1.f, 1.f })); break;
+			case 2: collider.SetPolygon(PolygonF({ {-1.f, -1.f}, {1.f, -1.f}, {0.f, 1.f} })); break;
+		}
+	};
+
+	for (int i = 0; i < 30; i++)
+	{
+		const auto bodyRef = world.CreateBody();
+		auto& body = world.GetBody(bodyRef);
+		auto& collider = world.GetCollider(world.CreateCollider(bodyRef));
+
+		body.SetPosition({ static_cast<float>(i % 6) * 1.5f, static_cast<float>(i / 6) * 1.5f });
+		body.SetUseGravity(false);
+		collider.SetIsTrigger(true);
+		setShape(collider, i);
+	}
+
+	const auto groundRef = world.CreateBody();
+	world.GetBody(groundRef).SetBodyType(BodyType::Static);
+	world.GetBody(groundRef).SetPosition(Vec2F(30.f, 20.f));
+	world.GetCollider(world.CreateCollider(groundRef)).SetRectangle(RectangleF(Vec2F(-20.f, -1.f), Vec2F(20.f, 1.f)));
+
+	// Stacked in columns, so the bodies touch the ground and each other
+	for (int i = 0; i < 24; i++)
+	{
+		const auto bodyRef = world.CreateBody();
+		auto& body = world.GetBody(bodyRef);
+
+		body.SetPosition({ 15.f + static_cast<float>(i % 8) * 3.f, 18.f - static_cast<float>(i / 8) * 1.9f });
+		body.SetMass(1.f);
+		body.SetUseGravity(true);
+		setShape(world.GetCollider(world.CreateCollider(bodyRef)), i);
+	}
+}
+
+/**
+ * @brief Count the allocations of the steps of a world, after the steps that let its buffers grow
+ */
+static std::size_t CountUpdateAllocations(World& world)
+{
+	for (int i = 0; i < 10; i++)
+	{
+		world.Update(1.f / 60.f);
+	}
+
+	return CountAllocations([&]()
+	{
+		for (int i = 0; i < 10; i++)
+		{
+			world.Update(1.f / 60.f);
+		}
+	});
+}
+
+TEST(Narrowphase, WorldUpdateDoesNotAllocate)
+{
+	World world;
+	CreateNarrowphaseWorld(world);
+
+	EXPECT_EQ(CountUpdateAllocations(world), 0);
+}
+
+TEST(Narrowphase, WorldUpdateWithSolverDoesNotAllocate)
+{
+	World world;
+	CreateNarrowphaseWorld(world);
+	world.SetSolverIterations(8);
+
+	EXPECT_EQ(CountUpdateAllocations(world), 0);
+}
+
+TEST(Narrowphase, WorldUpdateWithColoringDoesNotAllocate)
+{
+	World world;
+	CreateNarrowphaseWorld(world);
+	// The contacts are colored to be resolved in parallel
+	world.SetThreadCount(2);
+
+	EXPECT_EQ(CountUpdateAllocations(world), 0);
+}
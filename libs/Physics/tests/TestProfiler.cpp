@@ -0,0 +1,104 @@
+#include "Profiler.h"
+#include "World.h"
+
+#include <gtest/gtest.h>
+
+TEST(Profiler, Percentiles)
+{
+	auto& histogram = Profiler::GetHistogram("Test::percentiles", ProfileUnit::Count);
+
+	for (std::uint64_t i = 1; i <= 100; i++)
+	{
+		histogram.AddSample(i);
+	}
+
+	const auto statistics = histogram.Statistics();
+
+	EXPECT_EQ(statistics.Count, 100);
+	EXPECT_EQ(statistics.Total, 5050);
+	EXPECT_EQ(statistics.P50, 50);
+	EXPECT_EQ(statistics.P99, 99);
+	EXPECT_EQ(statistics.Max, 100);
+	EXPECT_EQ(&Profiler::GetHistogram("Test::percentiles"), &histogram);
+}
+
+TEST(Profiler, RollingWindow)
+{
+	auto& histogram = Profiler::GetHistogram("Test::window", ProfileUnit::Count);
+
+	histogram.AddSample(1'000'000);
+
+	// Push the big sample out of the window
+	for (std::size_t i = 0; i < ProfileHistogram::WindowSize; i++)
+	{
+		histogram.AddSample(1);
+	}
+
+	const auto statistics = histogram.Statistics();
+
+	EXPECT_EQ(statistics.Count, ProfileHistogram::WindowSize + 1);
+	EXPECT_EQ(statistics.Max, 1);
+
+	histogram.Reset();
+
+	EXPECT_EQ(histogram.Statistics().Count, 0);
+	EXPECT_EQ(histogram.Statistics().Max, 0);
+}
+
+TEST(Profiler, Timer)
+{
+	auto& histogram = Profiler::GetHistogram("Test::timer");
+
+	{
+		ProfileTimer timer(histogram);
+	}
+
+	EXPECT_EQ(histogram.Statistics().Count, 1);
+
+	Profiler::SetEnabled(false);
+
+	{
+		ProfileTimer timer(histogram);
+	}
+
+	Profiler::SetEnabled(true);
+
+	EXPECT_EQ(histogram.Statistics().Count, 1);
+}
+
+TEST(Profiler, WorldZones)
+{
+	Physics::World world;
+	world.CreateBody();
+	world.Update(1.f / 30.f);
+
+	for (const auto* name : { "World::Update", "World::updateBodies", "World::broadphase", "World::narrowphase" })
+	{
+		const auto* histogram = Profiler::FindHistogram(name);
+
+		ASSERT_NE(histogram, nullptr) << name;
+		EXPECT_GE(histogram->Statistics().Count, 1) << name;
+	}
+
+	EXPECT_EQ(Profiler::FindHistogram("Test::unknown"), nullptr);
+}
+
+TEST(Profiler, Export)
+{
+	auto& histogram = Profiler::GetHistogram("Test::export", ProfileUnit::Count);
+	histogram.Reset();
+	histogram.AddSample(7);
+
+	const auto json = Profiler::ToJson();
+
+	EXPECT_EQ(json.front(), '{');
+	EXPECT_EQ(json.back(), '}');
+	EXPECT_NE(json.find("\"Test::export\":{\"unit\":\"count\",\"count\":1,\"total\":7,\"p50\":7,\"p99\":7,\"max\":7}"), std::string::npos);
+
+	const auto prometheus = Profiler::ToPrometheus();
+
+	EXPECT_NE(prometheus.find("# TYPE profile_zone summary\n"), std::string::npos);
+	EXPECT_NE(prometheus.find("profile_zone{zone=\"Test::export\",unit=\"count\",quantile=\"0.99\"} 7\n"), std::string::npos);
+	EXPECT_NE(prometheus.find("profile_zone_count{zone=\"Test::export\",unit=\"count\"} 1\n"), std::string::npos);
+	EXPECT_NE(prometheus.find("profile_zone_max{zone=\"Test::export\",unit=\"count\"} 7\n"), std::string::npos);
+}
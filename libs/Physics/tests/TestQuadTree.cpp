@@ -28,7 +28,7 @@ TEST_P(TestQuadTreeFixture, InsertTopLeft)
 
 	std::vector<Physics::SimplifiedCollider> colliders;
 
-	for (std::size_t i = 0; i < Physics::QuadTree::MaxCapacity(); i++)
+	for (std::size_t i = 0; i < quadTree.MaxCapacity(); i++)
 	{
 		colliders.push_back({{i, 0}, topLeftRect});
 		quadTree.Insert(colliders.back());
@@ -56,7 +56,7 @@ TEST_P(TestQuadTreeFixture, InsertMid)
 
 	std::vector<Physics::SimplifiedCollider> colliders;
 
-	for (std::size_t i = 0; i < Physics::QuadTree::MaxCapacity(); i++)
+	for (std::size_t i = 0; i < quadTree.MaxCapacity(); i++)
 	{
 		colliders.push_back({{i, 0}, middleRect});
 		quadTree.Insert(colliders.back());
@@ -89,7 +89,7 @@ TEST_P(TestQuadTreeFixture, GetColliders)
 
 	std::vector<Physics::SimplifiedCollider> colliders;
 
-	for (std::size_t i = 0; i < Physics::QuadTree::MaxCapacity(); i++)
+	for (std::size_t i = 0; i < quadTree.MaxCapacity(); i++)
 	{
 		colliders.push_back({{i, 0}, middleRect});
 		quadTree.Insert(colliders.back());
@@ -116,7 +116,7 @@ TEST_P(TestQuadTreeFixture, ClearColliders)
 
 	std::vector<Physics::SimplifiedCollider> colliders;
 
-	for (std::size_t i = 0; i < Physics::QuadTree::MaxCapacity(); i++)
+	for (std::size_t i = 0; i < quadTree.MaxCapacity(); i++)
 	{
 		colliders.push_back({{i, 0}, middleRect});
 		quadTree.Insert(colliders.back());
@@ -130,3 +130,130 @@ TEST_P(TestQuadTreeFixture, ClearColliders)
 	EXPECT_EQ(quadTree.GetBoundaries().size(), 0);
 	EXPECT_EQ(quadTree.GetAllCollidersCount(), 0);
 }
+
+TEST_P(TestQuadTreeFixture, RemoveAndMoveColliders)
+{
+	auto rect = GetParam();
+	Physics::QuadTree quadTree(rect);
+	Math::Vec2F collidersSize = rect.Size() / 100.f;
+	Math::Vec2F center = rect.Center();
+	Math::RectangleF middleRect(center - collidersSize / 2.f, center + collidersSize / 2.f);
+	Math::RectangleF topLeftRect(rect.MinBound(), rect.MinBound() + collidersSize);
+
+	std::vector<Physics::SimplifiedCollider> colliders;
+
+	for (std::size_t i = 0; i < quadTree.MaxCapacity(); i++)
+	{
+		colliders.push_back({{i, 0}, middleRect});
+		quadTree.Insert(colliders.back());
+	}
+
+	EXPECT_EQ(quadTree.GetAllPossiblePairs().size(), colliders.size() * (colliders.size() - 1) / 2);
+
+	quadTree.Remove(colliders.back().Ref);
+	colliders.pop_back();
+
+	EXPECT_FALSE(quadTree.Contains({colliders.size(), 0}));
+	EXPECT_EQ(quadTree.GetAllCollidersCount(), colliders.size());
+	EXPECT_EQ(quadTree.GetAllPossiblePairs().size(), colliders.size() * (colliders.size() - 1) / 2);
+
+	// Move the first collider away from the others, it must not be paired anymore
+	quadTree.Move({colliders.front().Ref, topLeftRect});
+
+	EXPECT_TRUE(quadTree.Contains(colliders.front().Ref));
+	EXPECT_EQ(quadTree.GetAllCollidersCount(), colliders.size());
+	EXPECT_EQ(quadTree.GetAllPossiblePairs().size(), (colliders.size() - 1) * (colliders.size() - 2) / 2);
+
+	HeapAllocator allocator;
+	MyVector<Physics::ColliderPair> pairs { StandardAllocator<Physics::ColliderPair> {allocator} };
+	quadTree.AddPossiblePairs({{colliders.size(), 0}, topLeftRect}, pairs);
+
+	ASSERT_EQ(pairs.size(), 1);
+	EXPECT_EQ(pairs[0].B, colliders.front().Ref);
+}
+
+TEST_P(TestQuadTreeFixture, DeepQuadTreePairs)
+{
+	auto rect = GetParam();
+	Math::Vec2F collidersSize = rect.Size() / 20.f;
+
+	std::vector<Physics::SimplifiedCollider> colliders;
+
+	// Grid of overlapping colliders, each one overlaps its neighbours
+	for (std::size_t x = 0; x < 16; x++)
+	{
+		for (std::size_t y = 0; y < 16; y++)
+		{
+			const auto minBound = rect.MinBound() + Math::Vec2F(rect.Size().X * x / 16.f, rect.Size().Y * y / 16.f);
+			colliders.push_back({{colliders.size(), 0}, Math::RectangleF(minBound, minBound + collidersSize)});
+		}
+	}
+
+	std::size_t expectedPairs = 0;
+
+	for (std::size_t i = 0; i < colliders.size(); i++)
+	{
+		for (std::size_t j = i + 1; j < colliders.size(); j++)
+		{
+			if (Math::Intersect(colliders[i].Bounds, colliders[j].Bounds)) expectedPairs++;
+		}
+	}
+
+	for (std::size_t depth = 1; depth <= 6; depth++)
+	{
+		Physics::QuadTree quadTree(rect, depth, 4);
+
+		for (const auto& collider : colliders)
+		{
+			quadTree.Insert(collider);
+		}
+
+		EXPECT_EQ(quadTree.MaxDepth(), depth);
+		EXPECT_EQ(quadTree.GetAllCollidersCount(), colliders.size());
+		EXPECT_EQ(quadTree.GetAllPossiblePairs().size(), expectedPairs);
+
+		if (depth > 1)
+		{
+			EXPECT_GT(quadTree.GetBoundaries().size(), 5);
+		}
+	}
+}
+
+TEST_P(TestQuadTreeFixture, PairsOrder)
+{
+	auto rect = GetParam();
+	Math::Vec2F collidersSize = rect.Size() / 5.f;
+
+	// Enough capacity to keep all the colliders in the root, pairs must be in the same order as testing them one by one
+	Physics::QuadTree quadTree(rect, 1, 100);
+	std::vector<Physics::SimplifiedCollider> colliders;
+
+	for (std::size_t i = 0; i < 23; i++)
+	{
+		const auto minBound = rect.MinBound() + Math::Vec2F(rect.Size().X * (i % 5) / 5.f, rect.Size().Y * (i % 7) / 7.f);
+		colliders.push_back({{i, 0}, Math::RectangleF(minBound, minBound + collidersSize)});
+		quadTree.Insert(colliders.back());
+	}
+
+	std::vector<Physics::ColliderPair> expectedPairs;
+
+	for (std::size_t i = 0; i < colliders.size(); i++)
+	{
+		for (std::size_t j = i + 1; j < colliders.size(); j++)
+		{
+			if (!Math::Intersect(colliders[i].Bounds, colliders[j].Bounds)) continue;
+
+			expectedPairs.push_back({colliders[i].Ref, colliders[j].Ref});
+		}
+	}
+
+	const auto& pairs = quadTree.GetAllPossiblePairs();
+
+	ASSERT_EQ(pairs.size(), expectedPairs.size());
+
+	for (std::size_t i = 0; i < pairs.size(); i++)
+	{
+		EXPECT_EQ(pairs[i].A, expectedPairs[i].A);
+		EXPECT_EQ(pairs[i].B, expectedPairs[i].B);
+	}
+}
@@ -0,0 +1,90 @@
+#include "TimeOfImpact.h"
+
+#include <gtest/gtest.h>
+
+using namespace Physics;
+using namespace Math;
+
+static constexpr float Tolerance = 0.0001f;
+
+static Collider MakeCollider(Vec2F position)
+{
+	Collider collider;
+	collider.SetPosition(position);
+
+	return collider;
+}
+
+TEST(TimeOfImpact, RectangleThroughWall)
+{
+	auto box = MakeCollider(Vec2F::Zero());
+	box.SetRectangle(RectangleF({ -1.f, -1.f }, { 1.f, 1.f }));
+
+	auto wall = MakeCollider({ 10.f, 0.f });
+	wall.SetRectangle(RectangleF({ 0.f, -5.f }, { 0.5f, 5.f }));
+
+	// The box reaches the wall after 9 units of its 20 units displacement
+	const auto timeOfImpact = ComputeTimeOfImpact(box, Vec2F::Zero(), { 20.f, 0.f }, wall);
+
+	ASSERT_TRUE(timeOfImpact.IsHit);
+	EXPECT_NEAR(timeOfImpact.Time, 9.f / 20.f, Tolerance);
+	EXPECT_EQ(timeOfImpact.Normal, Vec2F(-1.f, 0.f));
+
+	// Too short, or going the other way
+	EXPECT_FALSE(ComputeTimeOfImpact(box, Vec2F::Zero(), { 8.f, 0.f }, wall).IsHit);
+	EXPECT_FALSE(ComputeTimeOfImpact(box, Vec2F::Zero(), { -20.f, 0.f }, wall).IsHit);
+	// Passing above the wall
+	EXPECT_FALSE(ComputeTimeOfImpact(box, { 0.f, 7.f }, { 20.f, 0.f }, wall).IsHit);
+}
+
+TEST(TimeOfImpact, Circles)
+{
+	auto circle = MakeCollider(Vec2F::Zero());
+	circle.SetCircle(CircleF(1.f));
+
+	auto target = MakeCollider({ 0.f, 10.f });
+	target.SetCircle(CircleF(2.f));
+
+	const auto timeOfImpact = ComputeTimeOfImpact(circle, Vec2F::Zero(), { 0.f, 14.f }, target);
+
+	ASSERT_TRUE(timeOfImpact.IsHit);
+	EXPECT_NEAR(timeOfImpact.Time, 7.f / 14.f, Tolerance);
+	EXPECT_NEAR(timeOfImpact.Normal.Y, -1.f, Tolerance);
+
+	// Already overlapping, left to the discrete collisions
+	EXPECT_FALSE(ComputeTimeOfImpact(circle, { 0.f, 8.f }, { 0.f, 14.f }, target).IsHit);
+}
+
+TEST(TimeOfImpact, OffCenterCircles)
+{
+	auto circle = MakeCollider(Vec2F::Zero());
+	circle.SetCircle(CircleF({ 0.f, 2.f }, 1.f));
+
+	auto target = MakeCollider({ 0.f, 10.f });
+	target.SetCircle(CircleF({ 0.f, 3.f }, 2.f));
+
+	// From y = 2 to the target around y = 13, touching at y = 10
+	const auto timeOfImpact = ComputeTimeOfImpact(circle, Vec2F::Zero(), { 0.f, 16.f }, target);
+
+	ASSERT_TRUE(timeOfImpact.IsHit);
+	EXPECT_NEAR(timeOfImpact.Time, 8.f / 16.f, Tolerance);
+	EXPECT_NEAR(timeOfImpact.Normal.Y, -1.f, Tolerance);
+
+	// Already overlapping around the centers, but not around the positions
+	EXPECT_FALSE(ComputeTimeOfImpact(circle, { 0.f, 9.f }, { 0.f, 16.f }, target).IsHit);
+}
+
+TEST(TimeOfImpact, CircleAgainstRectangle)
+{
+	auto circle = MakeCollider(Vec2F::Zero());
+	circle.SetCircle(CircleF(1.f));
+
+	auto ground = MakeCollider({ 0.f, 0.f });
+	ground.SetRectangle(RectangleF({ -10.f, 5.f }, { 10.f, 5.1f }));
+
+	const auto timeOfImpact = ComputeTimeOfImpact(circle, Vec2F::Zero(), { 0.f, 100.f }, ground);
+
+	ASSERT_TRUE(timeOfImpact.IsHit);
+	EXPECT_NEAR(timeOfImpact.Time, 4.f / 100.f, Tolerance);
+	EXPECT_EQ(timeOfImpact.Normal, Vec2F(0.f, -1.f));
+}
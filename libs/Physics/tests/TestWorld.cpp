@@ -2,9 +2,12 @@
 #include "Body.h"
 #include "Exception.h"
 
+#include "AllocationCounter.h"
+
 #include <gtest/gtest.h>
 
 #include <array>
+#include <memory>
 
 using namespace Physics;
 using namespace Math;
@@ -170,6 +173,113 @@ TEST_P(TestWorldFixtureTime, Update)
 	EXPECT_FLOAT_EQ(body.Force().Y, 0.f);
 }
 
+TEST(World, UpdateManyBodies)
+{
+	World world;
+	const Math::Vec2F gravity(0.f, 9.81f);
+	const float deltaTime = 1.f / 30.f;
+
+	world.SetGravity(gravity);
+
+	// 7 dynamic bodies, not a multiple of the 4 bodies integrated together
+	std::vector<BodyRef> bodyRefs;
+
+	for (std::size_t i = 0; i < 7; i++)
+	{
+		bodyRefs.push_back(world.CreateBody());
+
+		auto& body = world.GetBody(bodyRefs.back());
+
+		body.SetPosition(Math::Vec2F(static_cast<float>(i), 0.f));
+		body.SetVelocity(Math::Vec2F(1.f, i == 3 ? 1'000.f : 2.f));
+		body.SetMass(1.f + static_cast<float>(i));
+		body.SetUseGravity(i % 2 == 0);
+		body.AddForce(Math::Vec2F(static_cast<float>(i), -1.f));
+	}
+
+	auto kinematicRef = world.CreateBody();
+	auto& kinematicBody = world.GetBody(kinematicRef);
+	kinematicBody.SetBodyType(BodyType::Kinematic);
+	kinematicBody.SetVelocity(Math::Vec2F(3.f, 3.f));
+
+	std::vector<Body> expectedBodies;
+
+	for (const auto& bodyRef : bodyRefs)
+	{
+		auto body = world.GetBody(bodyRef);
+
+		if (body.UseGravity())
+		{
+			body.AddForce(gravity * body.Mass());
+		}
+
+		body.AddVelocity(body.Force() * body.InverseMass() * deltaTime);
+		body.SetVelocity({ body.Velocity().X, std::min(body.Velocity().Y, 400.f) });
+		body.AddPosition(body.Velocity() * deltaTime);
+
+		expectedBodies.push_back(body);
+	}
+
+	world.Update(deltaTime);
+
+	for (std::size_t i = 0; i < bodyRefs.size(); i++)
+	{
+		const auto& body = world.GetBody(bodyRefs[i]);
+
+		EXPECT_FLOAT_EQ(body.Position().X, expectedBodies[i].Position().X);
+		EXPECT_FLOAT_EQ(body.Position().Y, expectedBodies[i].Position().Y);
+		EXPECT_FLOAT_EQ(body.Velocity().X, expectedBodies[i].Velocity().X);
+		EXPECT_FLOAT_EQ(body.Velocity().Y, expectedBodies[i].Velocity().Y);
+		EXPECT_FLOAT_EQ(body.Force().X, 0.f);
+		EXPECT_FLOAT_EQ(body.Force().Y, 0.f);
+	}
+
+	EXPECT_FLOAT_EQ(world.GetBody(bodyRefs[3]).Velocity().Y, 400.f);
+	EXPECT_FLOAT_EQ(kinematicBody.Position().X, 3.f * deltaTime);
+	EXPECT_FLOAT_EQ(kinematicBody.Position().Y, 3.f * deltaTime);
+}
+
+TEST(World, CopyOutlivesOriginal)
+{
+	auto world = std::make_unique<World>();
+	world->SetGravity(Math::Vec2F(0.f, 9.81f));
+
+	std::vector<BodyRef> bodyRefs;
+
+	for (std::size_t i = 0; i < 4; i++)
+	{
+		bodyRefs.push_back(world->CreateBody());
+
+		auto& body = world->GetBody(bodyRefs.back());
+		body.SetPosition(Math::Vec2F(static_cast<float>(i) * 0.5f, 0.f));
+		body.SetUseGravity(true);
+
+		world->GetCollider(world->CreateCollider(bodyRefs.back())).SetCircle(CircleF(Vec2F::Zero(), 1.f));
+	}
+
+	world->Update(1.f / 30.f);
+
+	// The copy must not use the memory of the original, like a rollback snapshot
+	World copy(*world);
+	world->Update(1.f / 30.f);
+
+	std::vector<Vec2F> expectedPositions;
+
+	for (const auto& bodyRef : bodyRefs)
+	{
+		expectedPositions.push_back(world->GetBody(bodyRef).Position());
+	}
+
+	world.reset();
+	copy.Update(1.f / 30.f);
+
+	for (std::size_t i = 0; i < bodyRefs.size(); i++)
+	{
+		EXPECT_FLOAT_EQ(copy.GetBody(bodyRefs[i]).Position().X, expectedPositions[i].X);
+		EXPECT_FLOAT_EQ(copy.GetBody(bodyRefs[i]).Position().Y, expectedPositions[i].Y);
+	}
+}
+
 TEST(World, TriggerCircle)
 {
     HeapAllocator allocator;
@@ -471,4 +581,404 @@ TEST(World, CollisionCircleAndRectangle)
 
 	world.DestroyBody(bodyRef2);
 	world.DestroyBody(bodyRef3);
-}
\ No newline at end of file
+}
+TEST(World, CollisionWithStaticBody)
+{
+	World world;
+
+	auto interaction = Interaction::None;
+	auto interactionCount = 0;
+	auto* contactListener = new TestContactListener(interaction, interactionCount);
+
+	world.SetContactListener(contactListener);
+
+	auto groundBodyRef = world.CreateBody();
+	auto& groundBody = world.GetBody(groundBodyRef);
+	auto& groundCollider = world.GetCollider(world.CreateCollider(groundBodyRef));
+
+	groundBody.SetBodyType(BodyType::Static);
+	groundCollider.SetRectangle(RectangleF({-10.f, 0.f}, {10.f, 1.f}));
+
+	auto staticBodyRef = world.CreateBody();
+	auto& staticBody = world.GetBody(staticBodyRef);
+	auto& staticCollider = world.GetCollider(world.CreateCollider(staticBodyRef));
+
+	staticBody.SetBodyType(BodyType::Static);
+	staticBody.SetPosition({20.f, 0.f});
+	staticCollider.SetRectangle(RectangleF({0.f, 0.f}, {1.f, 1.f}));
+
+	auto bodyRef = world.CreateBody();
+	auto colliderRef = world.CreateCollider(bodyRef);
+	auto& collider = world.GetCollider(colliderRef);
+
+	world.GetBody(bodyRef).SetPosition({0.f, -5.f});
+	collider.SetRectangle(RectangleF({0.f, 0.f}, {1.f, 1.f}));
+
+	world.Update(1.f / 60.f);
+
+	EXPECT_EQ(interaction, Interaction::None);
+	EXPECT_EQ(interactionCount, 0);
+
+	world.GetBody(bodyRef).SetPosition({0.f, -0.5f});
+	world.Update(1.f / 60.f);
+
+	EXPECT_EQ(interaction, Interaction::Enter);
+	EXPECT_EQ(interactionCount, 1);
+
+	// Moving a static body must update the static quadtree
+	world.GetBody(bodyRef).SetPosition({20.f, -0.5f});
+	world.Update(1.f / 60.f);
+
+	EXPECT_EQ(interactionCount, 3); // Exit from the ground and enter in the other static body
+
+	staticBody.SetPosition({40.f, 0.f});
+	world.Update(1.f / 60.f);
+
+	EXPECT_EQ(interaction, Interaction::Exit);
+	EXPECT_EQ(interactionCount, 4);
+}
+
+class RecordContactListener : public ContactListener
+{
+public:
+	std::vector<std::array<std::size_t, 3>> Events;
+
+	void OnTriggerEnter(ColliderRef colliderRef, ColliderRef otherColliderRef) noexcept override {}
+	void OnTriggerExit(ColliderRef colliderRef, ColliderRef otherColliderRef) noexcept override {}
+	void OnTriggerStay(ColliderRef colliderRef, ColliderRef otherColliderRef) noexcept override {}
+
+	void OnCollisionEnter(ColliderRef colliderRef, ColliderRef otherColliderRef) noexcept override
+	{
+		Events.push_back({0, colliderRef.Index, otherColliderRef.Index});
+	}
+
+	void OnCollisionExit(ColliderRef colliderRef, ColliderRef otherColliderRef) noexcept override
+	{
+		Events.push_back({1, colliderRef.Index, otherColliderRef.Index});
+	}
+
+	void OnCollisionStay(ColliderRef colliderRef, ColliderRef otherColliderRef) noexcept override
+	{
+		Events.push_back({2, colliderRef.Index, otherColliderRef.Index});
+	}
+};
+
+TEST(World, ThreadCountDeterminism)
+{
+	struct Result
+	{
+		std::vector<Vec2F> Positions;
+		std::vector<std::array<std::size_t, 3>> Events;
+	};
+
+	const auto simulate = [](std::size_t threadCount)
+	{
+		World world;
+		RecordContactListener listener;
+		std::vector<BodyRef> bodyRefs;
+
+		world.SetContactListener(&listener);
+		world.SetGravity(Vec2F(0.f, 9.81f));
+		world.SetThreadCount(threadCount);
+
+		auto groundRef = world.CreateBody();
+		world.GetBody(groundRef).SetBodyType(BodyType::Static);
+		world.GetBody(groundRef).SetPosition(Vec2F(0.f, 25.f));
+		world.GetCollider(world.CreateCollider(groundRef)).SetRectangle(RectangleF(Vec2F(-5.f, -1.f), Vec2F(45.f, 1.f)));
+
+		// Overlapping circles falling on the ground and pushing each other
+		for (std::size_t i = 0; i < 400; i++)
+		{
+			bodyRefs.push_back(world.CreateBody());
+
+			auto& body = world.GetBody(bodyRefs.back());
+			body.SetPosition(Vec2F(static_cast<float>(i % 40), static_cast<float>(i / 40) * 1.5f));
+			body.SetMass(1.f + static_cast<float>(i % 3));
+			body.SetUseGravity(true);
+
+			world.GetCollider(world.CreateCollider(bodyRefs.back())).SetCircle(CircleF(Vec2F::Zero(), 0.8f));
+		}
+
+		for (int step = 0; step < 60; step++)
+		{
+			world.Update(1.f / 30.f);
+		}
+
+		Result result;
+
+		for (const auto& bodyRef : bodyRefs)
+		{
+			result.Positions.push_back(world.GetBody(bodyRef).Position());
+		}
+
+		result.Events = listener.Events;
+
+		return result;
+	};
+
+	const auto expected = simulate(1);
+
+	EXPECT_FALSE(expected.Events.empty());
+
+	for (const std::size_t threadCount : {2, 4, 8})
+	{
+		const auto result = simulate(threadCount);
+
+		ASSERT_EQ(result.Events, expected.Events);
+
+		for (std::size_t i = 0; i < result.Positions.size(); i++)
+		{
+			// Bitwise identical, whatever the number of threads
+			EXPECT_EQ(result.Positions[i].X, expected.Positions[i].X);
+			EXPECT_EQ(result.Positions[i].Y, expected.Positions[i].Y);
+		}
+	}
+}
+
+TEST(World, SleepingBodies)
+{
+	World world;
+	world.SetGravity(Vec2F(0.f, 10.f));
+	world.SetSleepThreshold(1.f, 10);
+
+	auto groundRef = world.CreateBody();
+	world.GetBody(groundRef).SetBodyType(BodyType::Static);
+	world.GetBody(groundRef).SetPosition(Vec2F(0.f, 10.f));
+	world.GetCollider(world.CreateCollider(groundRef)).SetRectangle(RectangleF(Vec2F(-10.f, -1.f), Vec2F(10.f, 1.f)));
+
+	const auto createBox = [&world](Vec2F position)
+	{
+		auto bodyRef = world.CreateBody();
+		auto& body = world.GetBody(bodyRef);
+
+		body.SetPosition(position);
+		body.SetMass(1.f);
+		body.SetUseGravity(true);
+		world.GetCollider(world.CreateCollider(bodyRef)).SetRectangle(RectangleF(Vec2F(-1.f, -1.f), Vec2F(1.f, 1.f)));
+
+		return bodyRef;
+	};
+
+	auto boxRef = createBox(Vec2F(0.f, 7.5f));
+
+	for (int i = 0; i < 60; i++)
+	{
+		world.Update(1.f / 30.f);
+	}
+
+	const auto& box = world.GetBody(boxRef);
+
+	ASSERT_FALSE(box.IsAwake());
+	EXPECT_EQ(box.Velocity(), Vec2F::Zero());
+
+	// A sleeping body is not moved anymore, even with gravity
+	const auto position = box.Position();
+	world.Update(1.f / 30.f);
+	EXPECT_EQ(box.Position(), position);
+
+	// A body falling on the sleeping one wakes it up
+	createBox(Vec2F(0.f, 4.f));
+
+	bool wokeUp = false;
+
+	for (int i = 0; i < 30 && !wokeUp; i++)
+	{
+		world.Update(1.f / 30.f);
+		wokeUp = box.IsAwake();
+	}
+
+	EXPECT_TRUE(wokeUp);
+
+	// Both bodies end up resting in the same island and sleep together
+	for (int i = 0; i < 120; i++)
+	{
+		world.Update(1.f / 30.f);
+	}
+
+	EXPECT_FALSE(box.IsAwake());
+
+	// Applying a force wakes the body up
+	world.GetBody(boxRef).AddForce(Vec2F(10.f, 0.f));
+	EXPECT_TRUE(box.IsAwake());
+}
+
+TEST(World, SleepingIsOptIn)
+{
+	World world;
+	world.SetGravity(Vec2F(0.f, 10.f));
+
+	auto groundRef = world.CreateBody();
+	world.GetBody(groundRef).SetBodyType(BodyType::Static);
+	world.GetBody(groundRef).SetPosition(Vec2F(0.f, 10.f));
+	world.GetCollider(world.CreateCollider(groundRef)).SetRectangle(RectangleF(Vec2F(-10.f, -1.f), Vec2F(10.f, 1.f)));
+
+	auto boxRef = world.CreateBody();
+	auto& box = world.GetBody(boxRef);
+	box.SetPosition(Vec2F(0.f, 7.5f));
+	box.SetMass(1.f);
+	box.SetUseGravity(true);
+	world.GetCollider(world.CreateCollider(boxRef)).SetRectangle(RectangleF(Vec2F(-1.f, -1.f), Vec2F(1.f, 1.f)));
+
+	for (int i = 0; i < 120; i++)
+	{
+		world.Update(1.f / 30.f);
+	}
+
+	EXPECT_TRUE(world.GetBody(boxRef).IsAwake());
+}
+
+TEST(World, SolverStack)
+{
+	World world;
+	world.SetGravity(Vec2F(0.f, 10.f));
+	world.SetSleepThreshold(0.f, 0);
+	world.SetSolverIterations(8);
+
+	auto groundRef = world.CreateBody();
+	world.GetBody(groundRef).SetBodyType(BodyType::Static);
+	world.GetBody(groundRef).SetPosition(Vec2F(0.f, 10.f));
+	world.GetCollider(world.CreateCollider(groundRef)).SetRectangle(RectangleF(Vec2F(-10.f, -1.f), Vec2F(10.f, 1.f)));
+
+	// Boxes of the same mass, each one slightly above the one below
+	std::array<BodyRef, 5> boxRefs {};
+
+	for (std::size_t i = 0; i < boxRefs.size(); i++)
+	{
+		boxRefs[i] = world.CreateBody();
+		auto& box = world.GetBody(boxRefs[i]);
+
+		box.SetPosition(Vec2F(0.f, 8.f - 2.05f * static_cast<float>(i)));
+		box.SetMass(1.f);
+		box.SetUseGravity(true);
+		world.GetCollider(world.CreateCollider(boxRefs[i])).SetRectangle(RectangleF(Vec2F(-1.f, -1.f), Vec2F(1.f, 1.f)));
+	}
+
+	for (int i = 0; i < 300; i++)
+	{
+		world.Update(1.f / 30.f);
+	}
+
+	// The stack stands still, each box resting on the one below
+	for (std::size_t i = 0; i < boxRefs.size(); i++)
+	{
+		const auto& box = world.GetBody(boxRefs[i]);
+
+		EXPECT_NEAR(box.Position().X, 0.f, 0.001f);
+		EXPECT_NEAR(box.Position().Y, 8.f - 2.f * static_cast<float>(i), 0.5f);
+		EXPECT_LT(box.Velocity().Length(), 1.f);
+	}
+
+	const auto topPosition = world.GetBody(boxRefs.back()).Position();
+
+	for (int i = 0; i < 30; i++)
+	{
+		world.Update(1.f / 30.f);
+	}
+
+	EXPECT_NEAR(world.GetBody(boxRefs.back()).Position().Y, topPosition.Y, 0.05f);
+}
+
+TEST(World, BulletDoesNotTunnel)
+{
+	const auto createWorld = [](World& world, bool isBullet)
+	{
+		world.SetGravity(Vec2F::Zero());
+
+		// A thin static wall, much thinner than the distance the body moves in a step
+		auto wallRef = world.CreateBody();
+		world.GetBody(wallRef).SetBodyType(BodyType::Static);
+		world.GetBody(wallRef).SetPosition(Vec2F(20.f, 0.f));
+		world.GetCollider(world.CreateCollider(wallRef)).SetRectangle(RectangleF(Vec2F(0.f, -10.f), Vec2F(0.2f, 10.f)));
+
+		auto bodyRef = world.CreateBody();
+		auto& body = world.GetBody(bodyRef);
+		body.SetIsBullet(isBullet);
+		world.GetCollider(world.CreateCollider(bodyRef)).SetRectangle(RectangleF(Vec2F(-0.5f, -0.5f), Vec2F(0.5f, 0.5f)));
+
+		// Let the wall enter the static quadtree, then shoot
+		world.Update(1.f / 30.f);
+		body.SetVelocity(Vec2F(1500.f, 0.f));
+
+		for (int i = 0; i < 3; i++)
+		{
+			world.Update(1.f / 30.f);
+		}
+
+		return world.GetBody(bodyRef).Position();
+	};
+
+	World normalWorld;
+	World bulletWorld;
+
+	EXPECT_GT(createWorld(normalWorld, false).X, 20.f);
+	EXPECT_LE(createWorld(bulletWorld, true).X, 19.5f + 0.001f);
+}
+
+TEST(World, BulletDoesNotTunnelThroughMovingBody)
+{
+	const auto createWorld = [](World& world, bool isBullet)
+	{
+		world.SetGravity(Vec2F::Zero());
+
+		// A thin dynamic wall coming toward the body, like a falling brick toward a jumping player
+		auto wallRef = world.CreateBody();
+		world.GetBody(wallRef).SetPosition(Vec2F(20.f, 0.f));
+		world.GetCollider(world.CreateCollider(wallRef)).SetRectangle(RectangleF(Vec2F(0.f, -10.f), Vec2F(0.2f, 10.f)));
+
+		auto bodyRef = world.CreateBody();
+		auto& body = world.GetBody(bodyRef);
+		body.SetIsBullet(isBullet);
+		world.GetCollider(world.CreateCollider(bodyRef)).SetRectangle(RectangleF(Vec2F(-0.5f, -0.5f), Vec2F(0.5f, 0.5f)));
+
+		world.Update(1.f / 30.f);
+		world.GetBody(wallRef).SetVelocity(Vec2F(-300.f, 0.f));
+		body.SetVelocity(Vec2F(1500.f, 0.f));
+
+		world.Update(1.f / 30.f);
+
+		return world.GetBody(bodyRef).Position().X - world.GetBody(wallRef).Position().X;
+	};
+
+	World normalWorld;
+	World bulletWorld;
+
+	EXPECT_GT(createWorld(normalWorld, false), 0.f);
+	EXPECT_LT(createWorld(bulletWorld, true), 0.f);
+}
+
+TEST(World, SnapshotDoesNotAllocate)
+{
+	World world;
+
+	for (int i = 0; i < 30; i++)
+	{
+		const auto bodyRef = world.CreateBody();
+		auto& body = world.GetBody(bodyRef);
+
+		body.SetPosition({ static_cast<float>(i % 6) * 1.5f, static_cast<float>(i / 6) * 1.5f });
+		world.GetCollider(world.CreateCollider(bodyRef)).SetCircle(CircleF(1.f));
+	}
+
+	world.Update(1.f / 60.f);
+
+	// The first copy allocates the buffers of the snapshot, the next ones copy into them like a rollback does every frame
+	World snapshot(world);
+
+	for (int i = 0; i < 3; i++)
+	{
+		world.Update(1.f / 60.f);
+		snapshot = world;
+	}
+
+	const auto count = CountAllocations([&]()
+	{
+		for (int i = 0; i < 10; i++)
+		{
+			world.Update(1.f / 60.f);
+			snapshot = world;
+			world = snapshot;
+		}
+	});
+
+	EXPECT_EQ(count, 0);
+}
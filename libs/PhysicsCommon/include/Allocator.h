@@ -1,7 +1,14 @@
 #pragma once
 
+#include "MemoryTracker.h"
+
+#include <array>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <vector>
 
 /**
@@ -23,7 +30,7 @@ protected:
      */
     std::size_t _size {};
     /**
-     * @brief Number of allocations
+     * @brief Number of allocations, not thread-safe so not counted by the allocators usable from several threads
      */
     std::size_t _allocations {};
 
@@ -57,9 +64,13 @@ public:
      */
     [[nodiscard]] std::size_t GetSize() const noexcept;
     /**
-     * @brief Get the number of allocations
+     * @brief Get the number of allocations, see MemoryTracker for the allocators usable from several threads
      */
     [[nodiscard]] std::size_t GetAllocations() const noexcept;
+    /**
+     * @brief Check if the memory allocated by this allocator can be deallocated by the other one
+     */
+    [[nodiscard]] virtual bool IsEqual(const Allocator& other) const noexcept;
 
 protected:
 	static std::size_t calculateAlignForwardAdjustment(const void* address, std::size_t alignment);
@@ -97,6 +108,10 @@ public:
      * @brief Clear allocator
      */
     void Clear() noexcept;
+    /**
+     * @brief Check if there is enough space left for an allocation
+     */
+    [[nodiscard]] bool CanAllocate(std::size_t size, std::size_t alignment) const noexcept;
 };
 
 /**
@@ -128,9 +143,18 @@ public:
     void Deallocate(void* ptr) noexcept override;
 };
 
+/**
+ * @brief Allocator on the heap, its allocations are counted in the memory tracker under its tag.
+ * Can be used from any thread
+ */
 class HeapAllocator final : public Allocator
 {
+private:
+	MemoryTag _tag;
+
 public:
+	explicit HeapAllocator(MemoryTag tag = MemoryTag::Untagged) noexcept : _tag(tag) {}
+
 	/**
 	 * @brief Allocate memory from allocator
 	 * @param size Size of memory to allocate
@@ -142,6 +166,198 @@ public:
 	 * @param ptr Pointer to memory to deallocate
 	 */
 	void Deallocate(void* ptr) noexcept override;
+	/**
+	 * @brief All heap allocators share the heap, the memory is counted back in the tag it was allocated with
+	 */
+	[[nodiscard]] bool IsEqual(const Allocator& other) const noexcept override;
+
+	[[nodiscard]] MemoryTag GetTag() const noexcept { return _tag; }
+};
+
+/**
+ * @brief Allocator of blocks of the same size, for objects allocated and deallocated one by one.
+ * Allocating and deallocating are a pop and a push on the list of free blocks, the memory is not owned
+ */
+class PoolAllocator final : public Allocator
+{
+private:
+	struct FreeBlock
+	{
+		FreeBlock* next {nullptr};
+	};
+
+	FreeBlock* _freeBlocks {nullptr};
+	std::size_t _blockSize;
+	std::size_t _blockAlignment;
+
+public:
+	/**
+	 * @brief Constructor, splits the memory in blocks
+	 * @param size Size of the memory
+	 * @param blockSize Size of a block, at least the size of a pointer
+	 * @param blockAlignment Alignment of the blocks, a power of two
+	 */
+	PoolAllocator(void* ptr, std::size_t size, std::size_t blockSize, std::size_t blockAlignment = alignof(std::max_align_t)) noexcept;
+	~PoolAllocator() override = default;
+
+	/**
+	 * @brief Allocate a block
+	 * @param size Size of memory to allocate, not more than the size of a block
+	 * @return Pointer to the block, nullptr if all the blocks are used
+	 */
+	[[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) noexcept override;
+	/**
+	 * @brief Give a block back to the pool
+	 * @param ptr Pointer to the block
+	 */
+	void Deallocate(void* ptr) noexcept override;
+	/**
+	 * @brief Free all the blocks
+	 */
+	void Clear() noexcept;
+
+	[[nodiscard]] std::size_t GetBlockSize() const noexcept { return _blockSize; }
+};
+
+/**
+ * @brief Linear allocator for the data of one step, deallocated all at once by Clear.
+ * Allocations that do not fit in the buffer go to the heap, and the next Clear grows the buffer to fit them,
+ * so steps that need the same memory as the last one do not call malloc
+ */
+class FrameAllocator final : public Allocator
+{
+private:
+	struct OverflowBlock
+	{
+		OverflowBlock* next {nullptr};
+		std::size_t size {0};
+	};
+
+	std::optional<LinearAllocator> _linearAllocator;
+	OverflowBlock* _overflowBlocks {nullptr};
+	// Size of the allocations that did not fit in the buffer since the last clear
+	std::size_t _overflowSize {0};
+	// The buffer and the overflow blocks are counted in the memory tracker, not the allocations in them
+	MemoryTag _tag;
+
+public:
+	/**
+	 * @brief Constructor
+	 * @param size Size of the first buffer, 0 to allocate it on the first Clear after some allocations
+	 * @param tag Subsystem the memory of the buffer is counted in
+	 */
+	explicit FrameAllocator(std::size_t size = 0, MemoryTag tag = MemoryTag::Untagged) noexcept;
+	/**
+	 * @brief A copy starts with its own empty buffer, the data allocated in a frame allocator belongs to its owner
+	 */
+	FrameAllocator(const FrameAllocator& other) noexcept;
+	/**
+	 * @brief Keeps its own buffer and its allocations, nothing is copied from the other allocator, see the copy constructor
+	 */
+	FrameAllocator& operator=(const FrameAllocator&) noexcept;
+	~FrameAllocator() override;
+
+	/**
+	 * @brief Allocate memory in the buffer, or on the heap until the next Clear if the buffer is full
+	 */
+	[[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) noexcept override;
+	/**
+	 * @brief Does nothing, the memory is given back by Clear
+	 */
+	void Deallocate(void*) noexcept override {}
+
+	/**
+	 * @brief Deallocate everything, all the pointers given before become invalid
+	 */
+	void Clear() noexcept;
+
+	/**
+	 * @brief Get the size of the buffer, without the allocations that did not fit in it
+	 */
+	[[nodiscard]] std::size_t GetCapacity() const noexcept;
+
+private:
+	void allocateBuffer(std::size_t size) noexcept;
+	void freeOverflowBlocks() noexcept;
+};
+
+/**
+ * @brief Thread-safe front end of another allocator. Each thread keeps the small blocks it deallocated in lists by size
+ * and allocates from them without locking, only the allocations that miss the cache lock the allocator behind.
+ * The allocations are counted in the memory tracker under its tag, give it an untagged allocator to not count them twice
+ */
+class ThreadCacheAllocator final : public Allocator
+{
+public:
+	/**
+	 * @brief Threads that have a cache at the same time, the others lock the allocator behind for every allocation
+	 */
+	static constexpr std::size_t MaxThreads = 64;
+	/**
+	 * @brief Sizes of the cached blocks, from 16 to 2048 bytes by powers of two, bigger allocations are not cached
+	 */
+	static constexpr std::size_t SizeClassCount = 8;
+	/**
+	 * @brief Blocks kept per size and per thread, the next ones go back to the allocator behind
+	 */
+	static constexpr std::size_t MaxCachedBlocks = 64;
+
+private:
+	struct CachedBlock
+	{
+		CachedBlock* next {nullptr};
+	};
+
+	// Aligned on a cache line so the threads do not write in the same line
+	struct alignas(64) ThreadCache
+	{
+		std::array<CachedBlock*, SizeClassCount> blocks {};
+		std::array<std::size_t, SizeClassCount> counts {};
+	};
+
+	Allocator& _allocator;
+	std::mutex _mutex;
+	MemoryTag _tag;
+	std::unique_ptr<ThreadCache[]> _threadCaches;
+
+public:
+	/**
+	 * @brief Constructor
+	 * @param allocator Allocator behind the caches, only used under a lock
+	 * @param tag Subsystem the allocations are counted in
+	 */
+	explicit ThreadCacheAllocator(Allocator& allocator, MemoryTag tag = MemoryTag::Untagged) noexcept;
+	/**
+	 * @brief Give the cached blocks of all the threads back, no thread can use the allocator anymore
+	 */
+	~ThreadCacheAllocator() override;
+
+	ThreadCacheAllocator(const ThreadCacheAllocator&) = delete;
+	ThreadCacheAllocator& operator=(const ThreadCacheAllocator&) = delete;
+
+	/**
+	 * @brief Allocate memory, from the cache of the thread if it has a block of this size
+	 * @param size Size of memory to allocate
+	 * @param alignment Alignment, not more than alignof(std::max_align_t)
+	 * @return Pointer to allocated memory
+	 */
+	[[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) noexcept override;
+	/**
+	 * @brief Deallocate memory in the cache of the thread, can be memory allocated by another thread
+	 * @param ptr Pointer to memory to deallocate
+	 */
+	void Deallocate(void* ptr) noexcept override;
+	/**
+	 * @brief Give the blocks cached by the calling thread back to the allocator behind
+	 */
+	void Trim() noexcept;
+
+	[[nodiscard]] MemoryTag GetTag() const noexcept { return _tag; }
+
+private:
+	void* allocateBlock(std::size_t size) noexcept;
+	void deallocateBlock(void* block) noexcept;
+	void trimCache(ThreadCache& cache) noexcept;
 };
 
 struct AllocationHeader
@@ -207,16 +423,17 @@ protected:
 
 // Forced to define these things in .h because otherwise the linker complains about undefined symbols
 
+// Containers only take the memory of another one when their allocators are equal, otherwise they move the elements
 template <class T, class U>
-constexpr bool operator== (const StandardAllocator<T>&, const StandardAllocator<U>&) noexcept
+bool operator== (const StandardAllocator<T>& allocator, const StandardAllocator<U>& other) noexcept
 {
-	return true;
+	return allocator.GetAllocator().IsEqual(other.GetAllocator());
 }
 
 template <class T, class U>
-constexpr bool operator!= (const StandardAllocator<T>&, const StandardAllocator<U>&) noexcept
+bool operator!= (const StandardAllocator<T>& allocator, const StandardAllocator<U>& other) noexcept
 {
-	return false;
+	return !(allocator == other);
 }
 
 template <typename T>
@@ -235,4 +452,7 @@ void StandardAllocator<T>::deallocate(T* ptr, std::size_t n)
 }
 
 template<typename T>
-using MyVector = std::vector<T, StandardAllocator<T>>;
\ No newline at end of file
+using MyVector = std::vector<T, StandardAllocator<T>>;
+
+template<typename T>
+using MyDeque = std::deque<T, StandardAllocator<T>>;
\ No newline at end of file
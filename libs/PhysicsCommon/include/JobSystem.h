@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A pool of worker threads that split loops in ranges and run them in parallel
+ */
+class JobSystem
+{
+public:
+	/**
+	 * @brief Start the worker threads
+	 * @param threadCount The number of threads running a loop, including the calling thread
+	 */
+	explicit JobSystem(std::size_t threadCount) noexcept;
+	~JobSystem() noexcept;
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	using RangeFunction = std::function<void(std::size_t begin, std::size_t end)>;
+
+private:
+	std::vector<std::thread> _workers;
+
+	// Only one loop runs at a time
+	std::mutex _parallelForMutex;
+	std::mutex _mutex;
+	std::condition_variable _jobCondition;
+	std::condition_variable _doneCondition;
+
+	const RangeFunction* _function { nullptr };
+	std::size_t _count { 0 };
+	std::size_t _rangeSize { 1 };
+	std::atomic<std::size_t> _nextRange { 0 };
+	std::size_t _runningWorkers { 0 };
+	std::uint64_t _generation { 0 };
+	bool _stop { false };
+
+	void workerLoop() noexcept;
+	/**
+	 * @brief Run ranges of the current loop until there are none left
+	 */
+	void runRanges() noexcept;
+
+public:
+	/**
+	 * @brief Call the function on ranges covering [0, count), returns when all the ranges are done
+	 * @param count The number of elements of the loop
+	 * @param minRangeSize The minimum number of elements per range, small loops are run on the calling thread
+	 * @param function The function called with the begin and end of each range
+	 */
+	void ParallelFor(std::size_t count, std::size_t minRangeSize, const RangeFunction& function) noexcept;
+
+	[[nodiscard]] std::size_t ThreadCount() const noexcept { return _workers.size() + 1; }
+};
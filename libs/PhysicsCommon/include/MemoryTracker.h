@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Subsystem an allocation is counted in
+ */
+enum class MemoryTag : std::uint8_t
+{
+	Untagged,
+	Physics,
+	QuadTree,
+	Rollback,
+	Network,
+	COUNT // Always last
+};
+
+/**
+ * @brief Memory used by a subsystem, the peak is the biggest live size since the start or the last ResetPeaks
+ */
+struct MemoryStatistics
+{
+	std::size_t LiveBytes { 0 };
+	std::size_t PeakBytes { 0 };
+	std::size_t LiveAllocations { 0 };
+	std::uint64_t Allocations { 0 };
+};
+
+/**
+ * @brief Live and peak bytes of each subsystem, filled by the tagged allocators.
+ * Counting is lock free so the allocators can be used from any thread
+ */
+class MemoryTracker
+{
+public:
+	static void OnAllocate(MemoryTag tag, std::size_t size) noexcept;
+	static void OnDeallocate(MemoryTag tag, std::size_t size) noexcept;
+
+	[[nodiscard]] static MemoryStatistics GetStatistics(MemoryTag tag) noexcept;
+	[[nodiscard]] static const char* GetTagName(MemoryTag tag) noexcept;
+	/**
+	 * @brief Set the peak of each subsystem to its live size, to see the peak of the next period only
+	 */
+	static void ResetPeaks() noexcept;
+
+	/**
+	 * @brief Export the statistics of all the subsystems as a JSON object, keyed by tag name
+	 */
+	[[nodiscard]] static std::string ToJson();
+	/**
+	 * @brief Export the statistics of all the subsystems in the Prometheus text format, as gauges and a counter
+	 */
+	[[nodiscard]] static std::string ToPrometheus();
+	/**
+	 * @brief Write the JSON export to path.json and the Prometheus export to path.prom
+	 * @return False if a file could not be written
+	 */
+	static bool WriteFiles(const std::string& path);
+};
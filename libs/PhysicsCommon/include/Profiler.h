@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief What the samples of a histogram are
+ */
+enum class ProfileUnit
+{
+	Nanoseconds,
+	Count
+};
+
+/**
+ * @brief Summary of the samples of a histogram, the percentiles and the maximum are over the last samples only
+ */
+struct ProfileStatistics
+{
+	std::uint64_t Count { 0 };
+	std::uint64_t Total { 0 };
+	std::uint64_t P50 { 0 };
+	std::uint64_t P99 { 0 };
+	std::uint64_t Max { 0 };
+};
+
+/**
+ * @brief Rolling histogram of a profiled zone, keeps the last samples to compute the percentiles when read.
+ * Adding a sample is lock free so it can be done from any thread
+ */
+class ProfileHistogram
+{
+public:
+	ProfileHistogram(std::string_view name, ProfileUnit unit) noexcept;
+
+	/**
+	 * @brief Number of samples kept for the percentiles
+	 */
+	static constexpr std::size_t WindowSize = 512;
+
+private:
+	std::string _name;
+	ProfileUnit _unit;
+
+	std::array<std::atomic<std::uint64_t>, WindowSize> _samples {};
+	std::atomic<std::uint64_t> _count { 0 };
+	std::atomic<std::uint64_t> _total { 0 };
+
+public:
+	void AddSample(std::uint64_t value) noexcept
+	{
+		const auto index = _count.fetch_add(1, std::memory_order_relaxed);
+
+		_samples[index % WindowSize].store(value, std::memory_order_relaxed);
+		_total.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Sort the last samples to get the percentiles, samples added while reading may be missed
+	 */
+	[[nodiscard]] ProfileStatistics Statistics() const noexcept;
+	void Reset() noexcept;
+
+	[[nodiscard]] const std::string& Name() const noexcept { return _name; }
+	[[nodiscard]] ProfileUnit Unit() const noexcept { return _unit; }
+};
+
+/**
+ * @brief Registry of the histograms of the process, always on and readable at any time, unlike Tracy which needs its viewer
+ */
+class Profiler
+{
+public:
+	/**
+	 * @brief Get the histogram with this name, created on the first call.
+	 * Keep the reference in a static, the lookup takes a lock
+	 */
+	[[nodiscard]] static ProfileHistogram& GetHistogram(std::string_view name, ProfileUnit unit = ProfileUnit::Nanoseconds);
+	/**
+	 * @return The histogram with this name or nullptr if nothing was profiled under it yet
+	 */
+	[[nodiscard]] static const ProfileHistogram* FindHistogram(std::string_view name) noexcept;
+
+	/**
+	 * @brief Enable or disable the timers, a disabled timer does not read the clock
+	 */
+	static void SetEnabled(bool isEnabled) noexcept;
+	[[nodiscard]] static bool IsEnabled() noexcept;
+	/**
+	 * @brief Remove the samples of all the histograms
+	 */
+	static void Reset() noexcept;
+
+	/**
+	 * @brief Export all the histograms as a JSON object, keyed by name
+	 */
+	[[nodiscard]] static std::string ToJson();
+	/**
+	 * @brief Export all the histograms in the Prometheus text format, as a summary with the quantiles 0.5 and 0.99 and a max gauge
+	 */
+	[[nodiscard]] static std::string ToPrometheus();
+	/**
+	 * @brief Write the JSON export to path.json and the Prometheus export to path.prom
+	 * @return False if a file could not be written
+	 */
+	static bool WriteFiles(const std::string& path);
+};
+
+/**
+ * @brief Add the time spent in its scope to a histogram
+ */
+class ProfileTimer
+{
+public:
+	explicit ProfileTimer(ProfileHistogram& histogram) noexcept
+	{
+		if (!Profiler::IsEnabled()) return;
+
+		_histogram = &histogram;
+		_start = std::chrono::steady_clock::now();
+	}
+
+	ProfileTimer(const ProfileTimer&) = delete;
+	ProfileTimer& operator=(const ProfileTimer&) = delete;
+
+	~ProfileTimer() noexcept
+	{
+		if (_histogram == nullptr) return;
+
+		const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start);
+
+		_histogram->AddSample(static_cast<std::uint64_t>(duration.count()));
+	}
+
+private:
+	ProfileHistogram* _histogram { nullptr };
+	std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * @brief Time the rest of the scope into the histogram with this name
+ */
+#define PROFILE_SCOPE(variable, name) \
+	static ProfileHistogram& variable##Histogram = Profiler::GetHistogram(name); \
+	const ProfileTimer variable(variable##Histogram)
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cstdint>
 #include "Allocator.h"
@@ -6,6 +8,101 @@
 #include <tracy/Tracy.hpp>
 #endif
 
+namespace
+{
+	// Written before the memory given by the heap and thread cache allocators, to count the deallocations in the right tag
+	struct AllocationTag
+	{
+		std::size_t size;
+		std::uint8_t sizeClass;
+		MemoryTag tag;
+	};
+
+	// Keeps the memory after it aligned like malloc
+	constexpr std::size_t allocationTagSize = alignof(std::max_align_t);
+	static_assert(sizeof(AllocationTag) <= allocationTagSize);
+
+	AllocationTag* tagOf(void* ptr) noexcept
+	{
+		return reinterpret_cast<AllocationTag*>(static_cast<std::uint8_t*>(ptr) - allocationTagSize);
+	}
+
+	void* dataOf(void* block) noexcept
+	{
+		return static_cast<std::uint8_t*>(block) + allocationTagSize;
+	}
+
+	/**
+	 * @brief Give each thread an index in the caches of the thread cache allocators, given back when the thread ends
+	 */
+	class ThreadIndices
+	{
+	public:
+		static constexpr std::size_t NoIndex = ThreadCacheAllocator::MaxThreads;
+
+		static ThreadIndices& Get() noexcept
+		{
+			static ThreadIndices threadIndices;
+
+			return threadIndices;
+		}
+
+		std::size_t Acquire() noexcept
+		{
+			std::scoped_lock lock(_mutex);
+
+			if (_freeCount > 0) return _freeIndices[--_freeCount];
+			if (_nextIndex < NoIndex) return _nextIndex++;
+
+			return NoIndex;
+		}
+
+		void Release(std::size_t index) noexcept
+		{
+			if (index == NoIndex) return;
+
+			std::scoped_lock lock(_mutex);
+
+			_freeIndices[_freeCount++] = index;
+		}
+
+	private:
+		std::mutex _mutex;
+		std::array<std::size_t, NoIndex> _freeIndices {};
+		std::size_t _freeCount = 0;
+		std::size_t _nextIndex = 0;
+	};
+
+	struct ThreadIndex
+	{
+		// Get the instance now so it is destroyed after the thread indices of the main thread
+		ThreadIndices& indices = ThreadIndices::Get();
+		const std::size_t index = indices.Acquire();
+
+		~ThreadIndex()
+		{
+			indices.Release(index);
+		}
+	};
+
+	std::size_t currentThreadIndex() noexcept
+	{
+		thread_local ThreadIndex threadIndex;
+
+		return threadIndex.index;
+	}
+
+	std::size_t sizeClassOf(std::size_t size) noexcept
+	{
+		return size <= 16 ? 0 : static_cast<std::size_t>(std::bit_width((size - 1) >> 4));
+	}
+
+	std::size_t sizeOfClass(std::size_t sizeClass) noexcept
+	{
+		return std::size_t { 16 } << sizeClass;
+	}
+}
+
 Allocator::Allocator(void* ptr, std::size_t size) noexcept :
     _rootPtr(ptr), _currentPtr(ptr), _size(size), _allocations(0) {}
 
@@ -29,6 +126,11 @@ std::size_t Allocator::GetAllocations() const noexcept
     return _allocations;
 }
 
+bool Allocator::IsEqual(const Allocator& other) const noexcept
+{
+    return this == &other;
+}
+
 std::size_t Allocator::calculateAlignForwardAdjustment(const void* address, std::size_t alignment)
 {
 	assert((alignment & (alignment - 1)) == 0 && "Alignment needs to be a power of two");
@@ -86,6 +188,15 @@ void LinearAllocator::Clear() noexcept
     _allocations = 0;
 }
 
+bool LinearAllocator::CanAllocate(std::size_t size, std::size_t alignment) const noexcept
+{
+    if (_rootPtr == nullptr) return false;
+
+    const auto adjustment = calculateAlignForwardAdjustment(_currentPtr, alignment);
+
+    return _offset + adjustment + size <= _size;
+}
+
 // ProxyAllocator implementation
 
 ProxyAllocator::ProxyAllocator(Allocator& allocator) noexcept :
@@ -119,13 +230,21 @@ void ProxyAllocator::Deallocate(void* ptr) noexcept
 
 void* HeapAllocator::Allocate(std::size_t size, std::size_t alignment) noexcept
 {
+	assert(alignment <= alignof(std::max_align_t) && "HeapAllocator cannot align more than malloc");
+
 	if (size == 0) return nullptr;
 
-	const auto space = size * alignment;
-	auto* ptr = std::malloc(space);
+	auto* block = std::malloc(allocationTagSize + size);
+
+	if (block == nullptr) return nullptr;
+
+	auto* ptr = dataOf(block);
+	*tagOf(ptr) = { size, 0, _tag };
+
+	MemoryTracker::OnAllocate(_tag, size);
 
 #ifdef TRACY_ENABLE
-	TracyAlloc(ptr, space);
+	TracyAlloc(ptr, size);
 #endif
 
 	return ptr;
@@ -139,7 +258,325 @@ void HeapAllocator::Deallocate(void* ptr) noexcept
 	TracyFree(ptr);
 #endif
 
-	std::free(ptr);
+	auto* allocationTag = tagOf(ptr);
+
+	MemoryTracker::OnDeallocate(allocationTag->tag, allocationTag->size);
+
+	std::free(allocationTag);
+}
+
+bool HeapAllocator::IsEqual(const Allocator& other) const noexcept
+{
+	return dynamic_cast<const HeapAllocator*>(&other) != nullptr;
+}
+
+// PoolAllocator implementation
+
+PoolAllocator::PoolAllocator(void* ptr, std::size_t size, std::size_t blockSize, std::size_t blockAlignment) noexcept :
+	Allocator(ptr, size), _blockAlignment(blockAlignment)
+{
+	assert((blockAlignment & (blockAlignment - 1)) == 0 && "Alignment needs to be a power of two");
+
+	// Each free block stores the pointer to the next one, and the blocks follow each other aligned
+	blockSize = std::max(blockSize, sizeof(FreeBlock));
+	_blockSize = (blockSize + blockAlignment - 1) & ~(blockAlignment - 1);
+
+	Clear();
+}
+
+void* PoolAllocator::Allocate(std::size_t size, std::size_t alignment) noexcept
+{
+	assert(size <= _blockSize && "PoolAllocator cannot allocate more than a block");
+	assert(alignment <= _blockAlignment && "PoolAllocator blocks are not aligned enough");
+
+	if (_freeBlocks == nullptr) return nullptr;
+
+	auto* block = _freeBlocks;
+	_freeBlocks = block->next;
+	_allocations++;
+
+#ifdef TRACY_ENABLE
+	TracyAlloc(block, _blockSize);
+#endif
+
+	return block;
+}
+
+void PoolAllocator::Deallocate(void* ptr) noexcept
+{
+	if (ptr == nullptr) return;
+
+#ifdef TRACY_ENABLE
+	TracyFree(ptr);
+#endif
+
+	auto* block = static_cast<FreeBlock*>(ptr);
+	block->next = _freeBlocks;
+	_freeBlocks = block;
+	_allocations--;
+}
+
+void PoolAllocator::Clear() noexcept
+{
+	_freeBlocks = nullptr;
+	_allocations = 0;
+
+	if (_rootPtr == nullptr) return;
+
+	const auto adjustment = calculateAlignForwardAdjustment(_rootPtr, _blockAlignment);
+
+	if (adjustment >= _size) return;
+
+	const auto blockCount = (_size - adjustment) / _blockSize;
+	const auto firstBlock = reinterpret_cast<std::uintptr_t>(_rootPtr) + adjustment;
+
+	// Link the blocks from the last one so the first allocations are at the start of the memory
+	for (std::size_t i = blockCount; i > 0; i--)
+	{
+		auto* block = reinterpret_cast<FreeBlock*>(firstBlock + (i - 1) * _blockSize);
+		block->next = _freeBlocks;
+		_freeBlocks = block;
+	}
+
+	_currentPtr = reinterpret_cast<void*>(firstBlock);
+}
+
+// FrameAllocator implementation
+
+FrameAllocator::FrameAllocator(std::size_t size, MemoryTag tag) noexcept : _tag(tag)
+{
+	if (size == 0) return;
+
+	allocateBuffer(size);
+}
+
+FrameAllocator::FrameAllocator(const FrameAllocator& other) noexcept : FrameAllocator(other.GetCapacity(), other._tag) {}
+
+FrameAllocator& FrameAllocator::operator=(const FrameAllocator&) noexcept
+{
+	// The other buffer only holds the data of its owner's frame, which is rebuilt after the next Clear,
+	// so keeping this buffer lets a copied world reuse its memory instead of allocating a new one
+	return *this;
+}
+
+FrameAllocator::~FrameAllocator()
+{
+	freeOverflowBlocks();
+
+	if (_linearAllocator.has_value())
+	{
+		MemoryTracker::OnDeallocate(_tag, GetCapacity());
+	}
+}
+
+void* FrameAllocator::Allocate(std::size_t size, std::size_t alignment) noexcept
+{
+	if (size == 0) return nullptr;
+
+	_allocations++;
+
+	if (_linearAllocator.has_value() && _linearAllocator->CanAllocate(size, alignment))
+	{
+		return _linearAllocator->Allocate(size, alignment);
+	}
+
+	// Keep the block in a list to free it on the next clear, the worst alignment is counted to grow the buffer enough
+	auto* rawPtr = std::malloc(sizeof(OverflowBlock) + alignment + size);
+
+	if (rawPtr == nullptr) return nullptr;
+
+	auto* block = static_cast<OverflowBlock*>(rawPtr);
+	block->next = _overflowBlocks;
+	block->size = size + alignment;
+	_overflowBlocks = block;
+	_overflowSize += block->size;
+
+	MemoryTracker::OnAllocate(_tag, block->size);
+
+	const auto* data = static_cast<const void*>(block + 1);
+
+	return reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(data) + calculateAlignForwardAdjustment(data, alignment));
+}
+
+void FrameAllocator::Clear() noexcept
+{
+	_allocations = 0;
+
+	freeOverflowBlocks();
+
+	if (_overflowSize > 0)
+	{
+		allocateBuffer(GetCapacity() + _overflowSize);
+		_overflowSize = 0;
+
+		return;
+	}
+
+	if (_linearAllocator.has_value())
+	{
+		_linearAllocator->Clear();
+	}
+}
+
+std::size_t FrameAllocator::GetCapacity() const noexcept
+{
+	return _linearAllocator.has_value() ? _linearAllocator->GetSize() : 0;
+}
+
+void FrameAllocator::allocateBuffer(std::size_t size) noexcept
+{
+	if (_linearAllocator.has_value())
+	{
+		MemoryTracker::OnDeallocate(_tag, GetCapacity());
+	}
+
+	// The linear allocator frees its old buffer
+	_linearAllocator.emplace(std::malloc(size), size);
+	_size = size;
+
+	MemoryTracker::OnAllocate(_tag, size);
+}
+
+void FrameAllocator::freeOverflowBlocks() noexcept
+{
+	while (_overflowBlocks != nullptr)
+	{
+		auto* next = _overflowBlocks->next;
+		MemoryTracker::OnDeallocate(_tag, _overflowBlocks->size);
+		std::free(_overflowBlocks);
+		_overflowBlocks = next;
+	}
+}
+
+// ThreadCacheAllocator implementation
+
+ThreadCacheAllocator::ThreadCacheAllocator(Allocator& allocator, MemoryTag tag) noexcept :
+	_allocator(allocator), _tag(tag), _threadCaches(std::make_unique<ThreadCache[]>(MaxThreads)) {}
+
+ThreadCacheAllocator::~ThreadCacheAllocator()
+{
+	for (std::size_t i = 0; i < MaxThreads; i++)
+	{
+		trimCache(_threadCaches[i]);
+	}
+}
+
+void* ThreadCacheAllocator::Allocate(std::size_t size, std::size_t alignment) noexcept
+{
+	assert(alignment <= alignof(std::max_align_t) && "ThreadCacheAllocator cannot align more than malloc");
+
+	if (size == 0) return nullptr;
+
+	const auto sizeClass = sizeClassOf(size);
+	const auto threadIndex = currentThreadIndex();
+	void* block = nullptr;
+
+	if (sizeClass < SizeClassCount && threadIndex != ThreadIndices::NoIndex)
+	{
+		auto& cache = _threadCaches[threadIndex];
+
+		if (cache.blocks[sizeClass] != nullptr)
+		{
+			auto* cachedBlock = cache.blocks[sizeClass];
+			cache.blocks[sizeClass] = cachedBlock->next;
+			cache.counts[sizeClass]--;
+			block = cachedBlock;
+		}
+	}
+
+	// Cached blocks are allocated with the size of their class to be reused by any allocation of the class
+	const auto blockSize = sizeClass < SizeClassCount ? sizeOfClass(sizeClass) : size;
+
+	if (block == nullptr)
+	{
+		block = allocateBlock(allocationTagSize + blockSize);
+
+		if (block == nullptr) return nullptr;
+	}
+
+	auto* ptr = dataOf(block);
+	*tagOf(ptr) = { blockSize, static_cast<std::uint8_t>(std::min(sizeClass, SizeClassCount)), _tag };
+
+	MemoryTracker::OnAllocate(_tag, blockSize);
+
+#ifdef TRACY_ENABLE
+	TracyAlloc(ptr, blockSize);
+#endif
+
+	return ptr;
+}
+
+void ThreadCacheAllocator::Deallocate(void* ptr) noexcept
+{
+	if (ptr == nullptr) return;
+
+#ifdef TRACY_ENABLE
+	TracyFree(ptr);
+#endif
+
+	const auto allocationTag = *tagOf(ptr);
+	void* block = tagOf(ptr);
+
+	MemoryTracker::OnDeallocate(allocationTag.tag, allocationTag.size);
+
+	const auto threadIndex = currentThreadIndex();
+
+	if (allocationTag.sizeClass < SizeClassCount && threadIndex != ThreadIndices::NoIndex)
+	{
+		auto& cache = _threadCaches[threadIndex];
+
+		if (cache.counts[allocationTag.sizeClass] < MaxCachedBlocks)
+		{
+			auto* cachedBlock = static_cast<CachedBlock*>(block);
+			cachedBlock->next = cache.blocks[allocationTag.sizeClass];
+			cache.blocks[allocationTag.sizeClass] = cachedBlock;
+			cache.counts[allocationTag.sizeClass]++;
+
+			return;
+		}
+	}
+
+	deallocateBlock(block);
+}
+
+void ThreadCacheAllocator::Trim() noexcept
+{
+	const auto threadIndex = currentThreadIndex();
+
+	if (threadIndex == ThreadIndices::NoIndex) return;
+
+	trimCache(_threadCaches[threadIndex]);
+}
+
+void* ThreadCacheAllocator::allocateBlock(std::size_t size) noexcept
+{
+	std::scoped_lock lock(_mutex);
+
+	return _allocator.Allocate(size, alignof(std::max_align_t));
+}
+
+void ThreadCacheAllocator::deallocateBlock(void* block) noexcept
+{
+	std::scoped_lock lock(_mutex);
+
+	_allocator.Deallocate(block);
+}
+
+void ThreadCacheAllocator::trimCache(ThreadCache& cache) noexcept
+{
+	std::scoped_lock lock(_mutex);
+
+	for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; sizeClass++)
+	{
+		while (cache.blocks[sizeClass] != nullptr)
+		{
+			auto* next = cache.blocks[sizeClass]->next;
+			_allocator.Deallocate(cache.blocks[sizeClass]);
+			cache.blocks[sizeClass] = next;
+		}
+
+		cache.counts[sizeClass] = 0;
+	}
 }
 
 FreeListAllocator::FreeListAllocator(void* ptr, std::size_t size) noexcept
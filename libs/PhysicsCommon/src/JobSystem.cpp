@@ -0,0 +1,98 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+JobSystem::JobSystem(std::size_t threadCount) noexcept
+{
+	for (std::size_t i = 1; i < threadCount; i++)
+	{
+		_workers.emplace_back(&JobSystem::workerLoop, this);
+	}
+}
+
+JobSystem::~JobSystem() noexcept
+{
+	{
+		std::scoped_lock lock(_mutex);
+		_stop = true;
+	}
+
+	_jobCondition.notify_all();
+
+	for (auto& worker : _workers)
+	{
+		worker.join();
+	}
+}
+
+void JobSystem::workerLoop() noexcept
+{
+	std::uint64_t generation = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock lock(_mutex);
+			_jobCondition.wait(lock, [this, generation] { return _stop || _generation != generation; });
+
+			if (_stop) return;
+
+			generation = _generation;
+		}
+
+		runRanges();
+
+		{
+			std::scoped_lock lock(_mutex);
+			_runningWorkers--;
+		}
+
+		_doneCondition.notify_one();
+	}
+}
+
+void JobSystem::runRanges() noexcept
+{
+	while (true)
+	{
+		const auto begin = _nextRange.fetch_add(1) * _rangeSize;
+
+		if (begin >= _count) return;
+
+		(*_function)(begin, std::min(begin + _rangeSize, _count));
+	}
+}
+
+void JobSystem::ParallelFor(std::size_t count, std::size_t minRangeSize, const RangeFunction& function) noexcept
+{
+	if (count == 0) return;
+
+	if (_workers.empty() || count <= minRangeSize)
+	{
+		function(0, count);
+		return;
+	}
+
+	std::scoped_lock parallelForLock(_parallelForMutex);
+
+	{
+		std::scoped_lock lock(_mutex);
+
+		// A few ranges per thread to balance the work
+		_function = &function;
+		_count = count;
+		_rangeSize = std::max(minRangeSize, count / (ThreadCount() * 4));
+		_nextRange = 0;
+		_runningWorkers = _workers.size();
+		_generation++;
+	}
+
+	_jobCondition.notify_all();
+
+	runRanges();
+
+	std::unique_lock lock(_mutex);
+	_doneCondition.wait(lock, [this] { return _runningWorkers == 0; });
+
+	_function = nullptr;
+}
@@ -0,0 +1,137 @@
+#include "MemoryTracker.h"
+
+#include <array>
+#include <atomic>
+#include <fstream>
+
+namespace
+{
+	struct TagCounters
+	{
+		std::atomic<std::size_t> LiveBytes { 0 };
+		std::atomic<std::size_t> PeakBytes { 0 };
+		std::atomic<std::size_t> LiveAllocations { 0 };
+		std::atomic<std::uint64_t> Allocations { 0 };
+	};
+
+	std::array<TagCounters, static_cast<std::size_t>(MemoryTag::COUNT)> tagCounters;
+
+	TagCounters& countersOf(MemoryTag tag) noexcept
+	{
+		return tagCounters[static_cast<std::size_t>(tag)];
+	}
+}
+
+void MemoryTracker::OnAllocate(MemoryTag tag, std::size_t size) noexcept
+{
+	auto& counters = countersOf(tag);
+
+	const auto liveBytes = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+	counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+	counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+
+	auto peakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+
+	while (liveBytes > peakBytes && !counters.PeakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed)) {}
+}
+
+void MemoryTracker::OnDeallocate(MemoryTag tag, std::size_t size) noexcept
+{
+	auto& counters = countersOf(tag);
+
+	counters.LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+	counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+MemoryStatistics MemoryTracker::GetStatistics(MemoryTag tag) noexcept
+{
+	const auto& counters = countersOf(tag);
+
+	MemoryStatistics statistics;
+	statistics.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+	statistics.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+	statistics.LiveAllocations = counters.LiveAllocations.load(std::memory_order_relaxed);
+	statistics.Allocations = counters.Allocations.load(std::memory_order_relaxed);
+
+	return statistics;
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag) noexcept
+{
+	switch (tag)
+	{
+		case MemoryTag::Untagged: return "untagged";
+		case MemoryTag::Physics: return "physics";
+		case MemoryTag::QuadTree: return "quadtree";
+		case MemoryTag::Rollback: return "rollback";
+		case MemoryTag::Network: return "network";
+		case MemoryTag::COUNT: break;
+	}
+
+	return "";
+}
+
+void MemoryTracker::ResetPeaks() noexcept
+{
+	for (auto& counters : tagCounters)
+	{
+		counters.PeakBytes.store(counters.LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+}
+
+std::string MemoryTracker::ToJson()
+{
+	std::string json = "{";
+
+	for (std::size_t i = 0; i < tagCounters.size(); i++)
+	{
+		const auto tag = static_cast<MemoryTag>(i);
+		const auto statistics = GetStatistics(tag);
+
+		if (json.size() > 1) json += ",";
+
+		json += "\"" + std::string(GetTagName(tag)) + "\":{";
+		json += "\"live_bytes\":" + std::to_string(statistics.LiveBytes);
+		json += ",\"peak_bytes\":" + std::to_string(statistics.PeakBytes);
+		json += ",\"live_allocations\":" + std::to_string(statistics.LiveAllocations);
+		json += ",\"allocations\":" + std::to_string(statistics.Allocations);
+		json += "}";
+	}
+
+	json += "}";
+
+	return json;
+}
+
+std::string MemoryTracker::ToPrometheus()
+{
+	std::string live = "# HELP memory_live_bytes Bytes allocated and not deallocated yet\n# TYPE memory_live_bytes gauge\n";
+	std::string peak = "# HELP memory_peak_bytes Biggest live bytes since the last reset of the peaks\n# TYPE memory_peak_bytes gauge\n";
+	std::string liveAllocations = "# HELP memory_live_allocations Allocations not deallocated yet\n# TYPE memory_live_allocations gauge\n";
+	std::string allocations = "# HELP memory_allocations_total Allocations since the start\n# TYPE memory_allocations_total counter\n";
+
+	for (std::size_t i = 0; i < tagCounters.size(); i++)
+	{
+		const auto tag = static_cast<MemoryTag>(i);
+		const auto statistics = GetStatistics(tag);
+		const auto labels = "{tag=\"" + std::string(GetTagName(tag)) + "\"} ";
+
+		live += "memory_live_bytes" + labels + std::to_string(statistics.LiveBytes) + "\n";
+		peak += "memory_peak_bytes" + labels + std::to_string(statistics.PeakBytes) + "\n";
+		liveAllocations += "memory_live_allocations" + labels + std::to_string(statistics.LiveAllocations) + "\n";
+		allocations += "memory_allocations_total" + labels + std::to_string(statistics.Allocations) + "\n";
+	}
+
+	return live + peak + liveAllocations + allocations;
+}
+
+bool MemoryTracker::WriteFiles(const std::string& path)
+{
+	std::ofstream json(path + ".json");
+	json << ToJson();
+
+	std::ofstream prometheus(path + ".prom");
+	prometheus << ToPrometheus();
+
+	return json.good() && prometheus.good();
+}
@@ -0,0 +1,192 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <mutex>
+
+namespace
+{
+	std::atomic<bool> isProfilerEnabled { true };
+
+	std::mutex& histogramsMutex()
+	{
+		static std::mutex mutex;
+
+		return mutex;
+	}
+
+	// A deque keeps the histograms in place when it grows, the references given stay valid
+	std::deque<ProfileHistogram>& histograms()
+	{
+		static std::deque<ProfileHistogram> histograms;
+
+		return histograms;
+	}
+
+	const char* unitName(ProfileUnit unit) noexcept
+	{
+		switch (unit)
+		{
+			case ProfileUnit::Nanoseconds: return "ns";
+			case ProfileUnit::Count: return "count";
+		}
+
+		return "";
+	}
+
+	std::string escape(std::string_view text)
+	{
+		std::string escaped;
+		escaped.reserve(text.size());
+
+		for (const auto character : text)
+		{
+			if (character == '"' || character == '\\') escaped += '\\';
+
+			escaped += character;
+		}
+
+		return escaped;
+	}
+}
+
+ProfileHistogram::ProfileHistogram(std::string_view name, ProfileUnit unit) noexcept : _name(name), _unit(unit) {}
+
+ProfileStatistics ProfileHistogram::Statistics() const noexcept
+{
+	ProfileStatistics statistics;
+	statistics.Count = _count.load(std::memory_order_relaxed);
+	statistics.Total = _total.load(std::memory_order_relaxed);
+
+	const auto sampleCount = static_cast<std::size_t>(std::min<std::uint64_t>(statistics.Count, WindowSize));
+
+	if (sampleCount == 0) return statistics;
+
+	std::array<std::uint64_t, WindowSize> samples {};
+
+	for (std::size_t i = 0; i < sampleCount; i++)
+	{
+		samples[i] = _samples[i].load(std::memory_order_relaxed);
+	}
+
+	std::sort(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(sampleCount));
+
+	// Nearest rank
+	statistics.P50 = samples[(sampleCount - 1) * 50 / 100];
+	statistics.P99 = samples[(sampleCount - 1) * 99 / 100];
+	statistics.Max = samples[sampleCount - 1];
+
+	return statistics;
+}
+
+void ProfileHistogram::Reset() noexcept
+{
+	_count.store(0, std::memory_order_relaxed);
+	_total.store(0, std::memory_order_relaxed);
+}
+
+ProfileHistogram& Profiler::GetHistogram(std::string_view name, ProfileUnit unit)
+{
+	std::scoped_lock lock(histogramsMutex());
+
+	for (auto& histogram : histograms())
+	{
+		if (histogram.Name() == name) return histogram;
+	}
+
+	return histograms().emplace_back(name, unit);
+}
+
+const ProfileHistogram* Profiler::FindHistogram(std::string_view name) noexcept
+{
+	std::scoped_lock lock(histogramsMutex());
+
+	for (const auto& histogram : histograms())
+	{
+		if (histogram.Name() == name) return &histogram;
+	}
+
+	return nullptr;
+}
+
+void Profiler::SetEnabled(bool isEnabled) noexcept
+{
+	isProfilerEnabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+bool Profiler::IsEnabled() noexcept
+{
+	return isProfilerEnabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::Reset() noexcept
+{
+	std::scoped_lock lock(histogramsMutex());
+
+	for (auto& histogram : histograms())
+	{
+		histogram.Reset();
+	}
+}
+
+std::string Profiler::ToJson()
+{
+	std::scoped_lock lock(histogramsMutex());
+
+	std::string json = "{";
+
+	for (const auto& histogram : histograms())
+	{
+		const auto statistics = histogram.Statistics();
+
+		if (json.size() > 1) json += ",";
+
+		json += "\"" + escape(histogram.Name()) + "\":{";
+		json += "\"unit\":\"" + std::string(unitName(histogram.Unit())) + "\"";
+		json += ",\"count\":" + std::to_string(statistics.Count);
+		json += ",\"total\":" + std::to_string(statistics.Total);
+		json += ",\"p50\":" + std::to_string(statistics.P50);
+		json += ",\"p99\":" + std::to_string(statistics.P99);
+		json += ",\"max\":" + std::to_string(statistics.Max);
+		json += "}";
+	}
+
+	json += "}";
+
+	return json;
+}
+
+std::string Profiler::ToPrometheus()
+{
+	std::scoped_lock lock(histogramsMutex());
+
+	std::string summary = "# HELP profile_zone Samples of the profiled zones, quantiles over the last "
+		+ std::to_string(ProfileHistogram::WindowSize) + " samples\n# TYPE profile_zone summary\n";
+	std::string max = "# HELP profile_zone_max Biggest of the last samples of the profiled zones\n# TYPE profile_zone_max gauge\n";
+
+	for (const auto& histogram : histograms())
+	{
+		const auto statistics = histogram.Statistics();
+		const auto labels = "zone=\"" + escape(histogram.Name()) + "\",unit=\"" + unitName(histogram.Unit()) + "\"";
+
+		summary += "profile_zone{" + labels + ",quantile=\"0.5\"} " + std::to_string(statistics.P50) + "\n";
+		summary += "profile_zone{" + labels + ",quantile=\"0.99\"} " + std::to_string(statistics.P99) + "\n";
+		summary += "profile_zone_sum{" + labels + "} " + std::to_string(statistics.Total) + "\n";
+		summary += "profile_zone_count{" + labels + "} " + std::to_string(statistics.Count) + "\n";
+		max += "profile_zone_max{" + labels + "} " + std::to_string(statistics.Max) + "\n";
+	}
+
+	return summary + max;
+}
+
+bool Profiler::WriteFiles(const std::string& path)
+{
+	std::ofstream json(path + ".json");
+	json << ToJson();
+
+	std::ofstream prometheus(path + ".prom");
+	prometheus << ToPrometheus();
+
+	return json.good() && prometheus.good();
+}
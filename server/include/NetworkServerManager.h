@@ -2,6 +2,7 @@
 
 #include "PacketManager.h"
 #include "ServerNetworkInterface.h"
+#include "Allocator.h"
 
 #include <atomic>
 #include <functional>
@@ -20,10 +21,14 @@ class NetworkServerManager final : public ServerNetworkInterface
 private:
 	static constexpr char MAX_CLIENTS = 100;
 
-	std::queue<PacketData> _packetsToProcess;
+	// The queues are filled and emptied by different threads, counted in the network memory
+	HeapAllocator _heapAllocator;
+	ThreadCacheAllocator _queueAllocator {_heapAllocator, MemoryTag::Network};
+
+	std::queue<PacketData, MyDeque<PacketData>> _packetsToProcess { MyDeque<PacketData> { StandardAllocator<PacketData> {_queueAllocator} } };
 	mutable std::mutex _mutexToProcessPackets;
 
-	std::queue<PacketData> _packetsToSend;
+	std::queue<PacketData, MyDeque<PacketData>> _packetsToSend { MyDeque<PacketData> { StandardAllocator<PacketData> {_queueAllocator} } };
 	mutable std::mutex _mutexToSendPackets;
 
 	std::queue<ClientId> _disconnectedClients;